@@ -47,6 +47,7 @@
 #include "Core/System.h"
 
 #include "DiscIO/Blob.h"
+#include "DiscIO/CompressedBlob.h"
 #include "DiscIO/Enums.h"
 #include "DiscIO/RiivolutionParser.h"
 #include "DiscIO/ScrubbedBlob.h"
@@ -717,9 +718,9 @@ JNIEXPORT jboolean JNICALL Java_org_dolphinemu_dolphinemu_NativeLibrary_ConvertD
     break;
 
   case DiscIO::BlobType::GCZ:
-    success =
-        DiscIO::ConvertToGCZ(blob_reader.get(), in_path, out_path,
-                             platform == DiscIO::Platform::WiiDisc ? 1 : 0, jBlockSize, callback);
+    success = DiscIO::ConvertToGCZ(
+        blob_reader.get(), in_path, out_path, platform == DiscIO::Platform::WiiDisc ? 1 : 0,
+        jBlockSize, DiscIO::GCZCompressionType::Deflate, DiscIO::GCZ_DEFLATE_LEVEL, callback);
     break;
 
   case DiscIO::BlobType::WIA:
@@ -9,6 +9,7 @@
 
 #include "Common/Event.h"
 #include "Common/Flag.h"
+#include "Common/SpinWait.h"
 
 namespace Common
 {
@@ -44,7 +45,13 @@ public:
     if (m_running_state.exchange(STATE_NEED_EXECUTION) != STATE_SLEEPING)
       return;
 
+    // A spinning worker will notice the new state by itself. It checks the state again after it
+    // stops spinning, so one of the two threads always sees the other's change.
+    if (m_spinning.load())
+      return;
+
     // Else as the worker thread may sleep now, we have to set the event.
+    m_sleep_spin.OnSignal();
     m_new_work_event.Set();
   }
 
@@ -176,6 +183,16 @@ public:
         [[fallthrough]];
 
       case STATE_SLEEPING:
+      {
+        // Spin for a bit first if new work has recently been arriving soon after we went to
+        // sleep, which saves a pair of syscalls.
+        m_spinning.store(true);
+        const bool woken = m_sleep_spin.Spin(
+            [this] { return m_running_state.load() != STATE_SLEEPING || m_shutdown.IsSet(); });
+        m_spinning.store(false);
+        if (woken || m_running_state.load() != STATE_SLEEPING)
+          break;
+
         // Just relax
         if (timeout > 0)
         {
@@ -185,8 +202,10 @@ public:
         {
           m_new_work_event.Wait();
         }
+        m_sleep_spin.OnSleepEnd();
         break;
       }
+      }
     }
 
     // Shutdown down, so get a safe state
@@ -232,6 +251,9 @@ public:
   // that we will fall back from the busy loop to sleeping.
   void AllowSleep() { m_may_sleep.Set(); }
 
+  // Counters for how the worker woke up after running out of work.
+  AdaptiveSpinWait::Stats GetSleepStats() const { return m_sleep_spin.GetStats(); }
+
 private:
   std::mutex m_wait_lock;
   std::mutex m_prepare_lock;
@@ -253,5 +275,8 @@ private:
 
   Flag m_may_sleep;  // If this is set, we fall back from the busy loop to an event based
                      // synchronization.
+
+  std::atomic<bool> m_spinning{false};  // Set while the worker spins instead of sleeping.
+  AdaptiveSpinWait m_sleep_spin;
 };
 }  // namespace Common
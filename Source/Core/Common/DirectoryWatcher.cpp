@@ -0,0 +1,194 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/DirectoryWatcher.h"
+
+#include <array>
+#include <cstring>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+#include "Common/CommonTypes.h"
+#include "Common/Logging/Log.h"
+
+namespace Common
+{
+#ifdef __linux__
+static constexpr u32 WATCH_MASK = IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_FROM |
+                                  IN_MOVED_TO | IN_ATTRIB | IN_DELETE_SELF | IN_MOVE_SELF;
+
+DirectoryWatcher::DirectoryWatcher()
+{
+  m_inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  m_wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (m_inotify_fd < 0 || m_wake_fd < 0)
+  {
+    WARN_LOG_FMT(COMMON, "Failed to set up inotify, file changes will be polled: {}",
+                 std::strerror(errno));
+    if (m_inotify_fd >= 0)
+      close(m_inotify_fd);
+    if (m_wake_fd >= 0)
+      close(m_wake_fd);
+    m_inotify_fd = -1;
+    m_wake_fd = -1;
+  }
+}
+
+DirectoryWatcher::~DirectoryWatcher()
+{
+  if (m_inotify_fd >= 0)
+    close(m_inotify_fd);
+  if (m_wake_fd >= 0)
+    close(m_wake_fd);
+}
+
+bool DirectoryWatcher::IsSupported() const
+{
+  return m_inotify_fd >= 0;
+}
+
+bool DirectoryWatcher::AddDirectory(const std::string& path)
+{
+  if (!IsSupported())
+    return false;
+
+  std::lock_guard lk(m_lock);
+  if (m_watches_by_path.contains(path))
+    return true;
+
+  const int watch = inotify_add_watch(m_inotify_fd, path.c_str(), WATCH_MASK | IN_ONLYDIR);
+  if (watch < 0)
+  {
+    WARN_LOG_FMT(COMMON, "Failed to watch {}: {}", path, std::strerror(errno));
+    return false;
+  }
+
+  m_paths_by_watch[watch] = path;
+  m_watches_by_path[path] = watch;
+  return true;
+}
+
+void DirectoryWatcher::RemoveDirectory(const std::string& path)
+{
+  std::lock_guard lk(m_lock);
+  const auto iter = m_watches_by_path.find(path);
+  if (iter == m_watches_by_path.end())
+    return;
+
+  inotify_rm_watch(m_inotify_fd, iter->second);
+  m_paths_by_watch.erase(iter->second);
+  m_watches_by_path.erase(iter);
+}
+
+DirectoryWatcher::Changes DirectoryWatcher::Wait(std::optional<std::chrono::milliseconds> timeout)
+{
+  Changes changes;
+  if (!IsSupported())
+    return changes;
+
+  std::array<pollfd, 2> fds{{{m_inotify_fd, POLLIN, 0}, {m_wake_fd, POLLIN, 0}}};
+  const int timeout_ms = timeout ? static_cast<int>(timeout->count()) : -1;
+  if (poll(fds.data(), fds.size(), timeout_ms) <= 0)
+    return changes;
+
+  if (fds[1].revents & POLLIN)
+  {
+    u64 value;
+    (void)!read(m_wake_fd, &value, sizeof(value));
+  }
+
+  // Read all of the queued events, not only the ones which were there when poll returned.
+  alignas(inotify_event) std::array<char, 16 * 1024> buffer;
+  while (true)
+  {
+    const ssize_t size = read(m_inotify_fd, buffer.data(), buffer.size());
+    if (size <= 0)
+      break;
+
+    std::lock_guard lk(m_lock);
+    for (ssize_t offset = 0; offset < size;)
+    {
+      const auto* event = reinterpret_cast<const inotify_event*>(buffer.data() + offset);
+      offset += sizeof(inotify_event) + event->len;
+
+      if (event->mask & IN_Q_OVERFLOW)
+      {
+        changes.overflowed = true;
+        continue;
+      }
+
+      const auto iter = m_paths_by_watch.find(event->wd);
+      if (iter == m_paths_by_watch.end())
+        continue;
+
+      // Events without a name are about the watched directory itself.
+      if (event->len == 0)
+        changes.directories.push_back(iter->second);
+      else
+        changes.paths.push_back(iter->second + '/' + event->name);
+
+      if (event->mask & IN_IGNORED)
+      {
+        // The directory itself is gone (watches removed with RemoveDirectory aren't in the map
+        // anymore). Watch it again in case it was replaced, otherwise it has to be polled.
+        const std::string path = iter->second;
+        m_paths_by_watch.erase(iter);
+        const int watch = inotify_add_watch(m_inotify_fd, path.c_str(), WATCH_MASK | IN_ONLYDIR);
+        if (watch >= 0)
+        {
+          m_paths_by_watch[watch] = path;
+          m_watches_by_path[path] = watch;
+        }
+        else
+        {
+          m_watches_by_path.erase(path);
+          changes.unwatched_directories.push_back(path);
+        }
+      }
+    }
+  }
+
+  return changes;
+}
+
+void DirectoryWatcher::Interrupt()
+{
+  if (!IsSupported())
+    return;
+
+  const u64 value = 1;
+  (void)!write(m_wake_fd, &value, sizeof(value));
+}
+#else
+DirectoryWatcher::DirectoryWatcher() = default;
+DirectoryWatcher::~DirectoryWatcher() = default;
+
+bool DirectoryWatcher::IsSupported() const
+{
+  return false;
+}
+
+bool DirectoryWatcher::AddDirectory(const std::string& path)
+{
+  return false;
+}
+
+void DirectoryWatcher::RemoveDirectory(const std::string& path)
+{
+}
+
+DirectoryWatcher::Changes DirectoryWatcher::Wait(std::optional<std::chrono::milliseconds> timeout)
+{
+  return {};
+}
+
+void DirectoryWatcher::Interrupt()
+{
+}
+#endif
+}  // namespace Common
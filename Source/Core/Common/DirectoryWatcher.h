@@ -0,0 +1,66 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Common
+{
+// Reports changes to the files in a set of directories, so that callers don't have to poll the
+// files themselves. Only implemented with inotify on Linux. Elsewhere IsSupported() returns false
+// and callers have to keep polling.
+//
+// Subdirectories aren't watched unless they are added as well.
+class DirectoryWatcher
+{
+public:
+  struct Changes
+  {
+    // Files and directories which were created, written, deleted or moved in or out of a watched
+    // directory.
+    std::vector<std::string> paths;
+    // Watched directories which changed themselves, e.g. by being deleted or having their
+    // attributes changed.
+    std::vector<std::string> directories;
+    // Watched directories which are gone and couldn't be watched again. They are no longer watched,
+    // so changes to them have to be polled.
+    std::vector<std::string> unwatched_directories;
+    // Set if the kernel dropped events, in which case everything has to be checked again.
+    bool overflowed = false;
+  };
+
+  DirectoryWatcher();
+  ~DirectoryWatcher();
+
+  DirectoryWatcher(const DirectoryWatcher&) = delete;
+  DirectoryWatcher& operator=(const DirectoryWatcher&) = delete;
+
+  bool IsSupported() const;
+
+  // Can be called from any thread. Adding a directory which is already watched does nothing.
+  bool AddDirectory(const std::string& path);
+  void RemoveDirectory(const std::string& path);
+
+  // Blocks until there are changes, Interrupt() is called, or the timeout (if any) expires.
+  Changes Wait(std::optional<std::chrono::milliseconds> timeout = std::nullopt);
+
+  // Makes a current or the next call to Wait() return immediately.
+  void Interrupt();
+
+private:
+#ifdef __linux__
+  int m_inotify_fd = -1;
+  int m_wake_fd = -1;
+#endif
+
+  std::mutex m_lock;
+  std::map<int, std::string> m_paths_by_watch;
+  std::map<std::string, int> m_watches_by_path;
+};
+}  // namespace Common
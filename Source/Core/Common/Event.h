@@ -6,6 +6,7 @@
 // other tasks.
 // * Set(): triggers the event and wakes up the waiting thread.
 // * Wait(): waits for the event to be triggered.
+// * TryWait(): returns whether the event was triggered, without waiting.
 // * Reset(): tries to reset the event before the waiting thread sees it was
 //            triggered. Usually a bad idea.
 
@@ -55,6 +56,8 @@ public:
     m_condvar.wait(lk, [&] { return m_flag.TestAndClear(); });
   }
 
+  bool TryWait() { return m_flag.IsSet() && m_flag.TestAndClear(); }
+
   template <class Rep, class Period>
   bool WaitFor(const std::chrono::duration<Rep, Period>& rel_time)
   {
@@ -0,0 +1,274 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/IOUringReader.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "Common/MsgHandler.h"
+
+namespace File
+{
+#ifdef __linux__
+// Number of requests which are in flight at once, and the size of each of them.
+static constexpr u32 QUEUE_DEPTH = 16;
+static constexpr u32 REQUEST_SIZE = 0x20000;
+
+template <typename T>
+static T* RingPointer(void* ring, u32 offset)
+{
+  return reinterpret_cast<T*>(static_cast<u8*>(ring) + offset);
+}
+
+static u32 LoadAcquire(const u32* value)
+{
+  return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+}
+
+static void StoreRelease(u32* value, u32 new_value)
+{
+  __atomic_store_n(value, new_value, __ATOMIC_RELEASE);
+}
+
+IOUringReader::IOUringReader()
+{
+  io_uring_params params{};
+  m_ring_fd = static_cast<int>(syscall(__NR_io_uring_setup, QUEUE_DEPTH, &params));
+  if (m_ring_fd < 0)
+  {
+    INFO_LOG_FMT(COMMON, "io_uring is unavailable, using regular reads: {}", std::strerror(errno));
+    m_ring_fd = -1;
+    return;
+  }
+
+  m_sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(u32);
+  m_cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+  if (params.features & IORING_FEAT_SINGLE_MMAP)
+    m_sq_ring_size = m_cq_ring_size = std::max(m_sq_ring_size, m_cq_ring_size);
+  m_sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+
+  m_sq_ring = mmap(nullptr, m_sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                   m_ring_fd, IORING_OFF_SQ_RING);
+  if (m_sq_ring == MAP_FAILED)
+    m_sq_ring = nullptr;
+
+  if (params.features & IORING_FEAT_SINGLE_MMAP)
+  {
+    m_cq_ring = m_sq_ring;
+  }
+  else
+  {
+    m_cq_ring = mmap(nullptr, m_cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                     m_ring_fd, IORING_OFF_CQ_RING);
+    if (m_cq_ring == MAP_FAILED)
+      m_cq_ring = nullptr;
+  }
+
+  m_sqes = mmap(nullptr, m_sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                m_ring_fd, IORING_OFF_SQES);
+  if (m_sqes == MAP_FAILED)
+    m_sqes = nullptr;
+
+  if (!m_sq_ring || !m_cq_ring || !m_sqes)
+  {
+    WARN_LOG_FMT(COMMON, "Failed to map the io_uring queues: {}", std::strerror(errno));
+    Close();
+    return;
+  }
+
+  m_sq_tail = RingPointer<u32>(m_sq_ring, params.sq_off.tail);
+  m_sq_mask = RingPointer<u32>(m_sq_ring, params.sq_off.ring_mask);
+  m_sq_array = RingPointer<u32>(m_sq_ring, params.sq_off.array);
+  m_cq_head = RingPointer<u32>(m_cq_ring, params.cq_off.head);
+  m_cq_tail = RingPointer<u32>(m_cq_ring, params.cq_off.tail);
+  m_cq_mask = RingPointer<u32>(m_cq_ring, params.cq_off.ring_mask);
+  m_cqes = RingPointer<void>(m_cq_ring, params.cq_off.cqes);
+
+  if (!ProbeReadSupport())
+  {
+    INFO_LOG_FMT(COMMON, "io_uring doesn't support reads on this kernel, using regular reads");
+    Close();
+  }
+}
+
+bool IOUringReader::ProbeReadSupport()
+{
+  // Probing was added in the same kernel version as IORING_OP_READ, so if it fails, reads aren't
+  // supported either
+  constexpr u32 MAX_OPS = IORING_OP_READ + 1;
+  std::vector<u8> storage(sizeof(io_uring_probe) + MAX_OPS * sizeof(io_uring_probe_op));
+  io_uring_probe* probe = reinterpret_cast<io_uring_probe*>(storage.data());
+  if (syscall(__NR_io_uring_register, m_ring_fd, IORING_REGISTER_PROBE, probe, MAX_OPS) < 0)
+    return false;
+
+  return probe->ops_len > IORING_OP_READ &&
+         (probe->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED) != 0;
+}
+
+IOUringReader::~IOUringReader()
+{
+  Close();
+}
+
+void IOUringReader::Close()
+{
+  if (m_sqes)
+    munmap(m_sqes, m_sqes_size);
+  if (m_cq_ring && m_cq_ring != m_sq_ring)
+    munmap(m_cq_ring, m_cq_ring_size);
+  if (m_sq_ring)
+    munmap(m_sq_ring, m_sq_ring_size);
+  if (m_ring_fd >= 0)
+    close(m_ring_fd);
+
+  m_sqes = nullptr;
+  m_cq_ring = nullptr;
+  m_sq_ring = nullptr;
+  m_ring_fd = -1;
+}
+
+bool IOUringReader::IsSupported() const
+{
+  return m_ring_fd >= 0;
+}
+
+void IOUringReader::PrepareRead(u32 tail, int fd, size_t request_index)
+{
+  const Request& request = m_requests[request_index];
+
+  const u32 index = tail & *m_sq_mask;
+  io_uring_sqe* sqe = static_cast<io_uring_sqe*>(m_sqes) + index;
+  std::memset(sqe, 0, sizeof(*sqe));
+  sqe->opcode = IORING_OP_READ;
+  sqe->fd = fd;
+  sqe->off = request.offset;
+  sqe->addr = reinterpret_cast<u64>(request.buffer);
+  sqe->len = request.length;
+  sqe->user_data = request_index;
+  m_sq_array[index] = index;
+}
+
+bool IOUringReader::Read(IOFile& file, u64 offset, u8* buffer, size_t length)
+{
+  if (!IsSupported() || !file.IsOpen())
+    return false;
+
+  // The data may still be sitting in the buffer of the C library if it was just written
+  file.Flush();
+  const int fd = fileno(file.GetHandle());
+
+  m_requests.clear();
+  for (size_t position = 0; position < length; position += REQUEST_SIZE)
+  {
+    const u32 request_length = static_cast<u32>(std::min<size_t>(REQUEST_SIZE, length - position));
+    m_requests.push_back(Request{offset + position, buffer + position, request_length});
+  }
+
+  // Requests which have to be submitted, either for the first time or again after a short read
+  std::vector<size_t> queue(m_requests.size());
+  for (size_t i = 0; i < queue.size(); ++i)
+    queue[i] = queue.size() - 1 - i;
+
+  u32 in_flight = 0;
+  bool success = true;
+  while (in_flight > 0 || (success && !queue.empty()))
+  {
+    // Fill up the submission queue, and submit all of the new requests with the same system call
+    // that waits for at least one request to finish. Only this thread writes to the tail, so it
+    // doesn't need to be loaded atomically.
+    const u32 sq_tail = *m_sq_tail;
+    u32 to_submit = 0;
+    if (success)
+    {
+      to_submit = std::min<u32>(QUEUE_DEPTH - in_flight, static_cast<u32>(queue.size()));
+      for (u32 i = 0; i < to_submit; ++i)
+        PrepareRead(sq_tail + i, fd, queue[queue.size() - 1 - i]);
+      StoreRelease(m_sq_tail, sq_tail + to_submit);
+    }
+
+    // Requests which are in flight write to the buffer, so even after an error, this has to wait
+    // until all of them are done.
+    const long result = syscall(__NR_io_uring_enter, m_ring_fd, to_submit, 1,
+                                IORING_ENTER_GETEVENTS, nullptr, 0);
+
+    // The kernel only returns an error if it didn't consume any of the new entries. Entries which
+    // weren't consumed are removed from the ring again, so that a later call can't submit reads
+    // into a buffer which was already handed back to the caller.
+    const u32 submitted = result > 0 ? std::min(static_cast<u32>(result), to_submit) : 0;
+    if (submitted != to_submit)
+      StoreRelease(m_sq_tail, sq_tail + submitted);
+    queue.resize(queue.size() - submitted);
+    in_flight += submitted;
+
+    if (result < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY)
+    {
+      if (to_submit == 0)
+      {
+        // Without being able to wait, the buffer can't be handed back safely
+        PanicAlertFmt("Failed to wait for io_uring reads: {}", std::strerror(errno));
+        return false;
+      }
+
+      ERROR_LOG_FMT(COMMON, "Failed to submit io_uring reads: {}", std::strerror(errno));
+      success = false;
+    }
+
+    u32 head = *m_cq_head;
+    const u32 tail = LoadAcquire(m_cq_tail);
+    for (; head != tail; ++head)
+    {
+      const io_uring_cqe& cqe = static_cast<const io_uring_cqe*>(m_cqes)[head & *m_cq_mask];
+      Request& request = m_requests[cqe.user_data];
+      --in_flight;
+
+      if (cqe.res == -EINTR || cqe.res == -EAGAIN)
+      {
+        queue.push_back(cqe.user_data);
+      }
+      else if (cqe.res <= 0)
+      {
+        if (cqe.res < 0)
+          ERROR_LOG_FMT(COMMON, "io_uring read failed: {}", std::strerror(-cqe.res));
+        success = false;
+      }
+      else if (static_cast<u32>(cqe.res) < request.length)
+      {
+        // Short read, read the rest of the request again
+        request.offset += cqe.res;
+        request.buffer += cqe.res;
+        request.length -= cqe.res;
+        queue.push_back(cqe.user_data);
+      }
+    }
+    StoreRelease(m_cq_head, head);
+  }
+
+  return success;
+}
+#else
+IOUringReader::IOUringReader() = default;
+IOUringReader::~IOUringReader() = default;
+
+bool IOUringReader::IsSupported() const
+{
+  return false;
+}
+
+bool IOUringReader::Read(IOFile&, u64, u8*, size_t)
+{
+  return false;
+}
+#endif
+}  // namespace File
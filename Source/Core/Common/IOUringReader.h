@@ -0,0 +1,75 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace File
+{
+class IOFile;
+
+// Reads large ranges of a file with io_uring, splitting them into several requests which are all
+// in flight at once. Storage which handles many requests in parallel (NVMe drives, network file
+// systems) is a lot faster this way than with one blocking read at a time.
+//
+// Only implemented on Linux. Elsewhere, or if the kernel doesn't allow io_uring or is too old to
+// support reads with it (before 5.6), IsSupported() returns false and callers have to use regular
+// reads instead.
+//
+// Not thread-safe. Each thread that reads should have its own reader.
+class IOUringReader
+{
+public:
+  // Reads smaller than this don't gain anything from being split up.
+  static constexpr size_t MIN_READ_SIZE = 0x40000;
+
+  IOUringReader();
+  ~IOUringReader();
+
+  IOUringReader(const IOUringReader&) = delete;
+  IOUringReader& operator=(const IOUringReader&) = delete;
+
+  bool IsSupported() const;
+
+  // Reads exactly length bytes. Returns false if there was an error or the end of the file was
+  // reached. Doesn't change the position of the file.
+  bool Read(IOFile& file, u64 offset, u8* buffer, size_t length);
+
+private:
+#ifdef __linux__
+  struct Request
+  {
+    u64 offset;
+    u8* buffer;
+    u32 length;
+  };
+
+  void Close();
+  bool ProbeReadSupport();
+  void PrepareRead(u32 tail, int fd, size_t request_index);
+
+  int m_ring_fd = -1;
+
+  void* m_sq_ring = nullptr;
+  size_t m_sq_ring_size = 0;
+  void* m_cq_ring = nullptr;
+  size_t m_cq_ring_size = 0;
+  void* m_sqes = nullptr;
+  size_t m_sqes_size = 0;
+
+  u32* m_sq_tail = nullptr;
+  u32* m_sq_mask = nullptr;
+  u32* m_sq_array = nullptr;
+  u32* m_cq_head = nullptr;
+  u32* m_cq_tail = nullptr;
+  u32* m_cq_mask = nullptr;
+  void* m_cqes = nullptr;
+
+  std::vector<Request> m_requests;
+#endif
+};
+}  // namespace File
@@ -6,11 +6,17 @@
 #include <algorithm>
 #include <cstring>
 #include <memory>
+#include <span>
 #include <string>
+#include <string_view>
 #include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
 #include "Common/IOFile.h"
+#include "Common/MappedFile.h"
 #include "Common/Version.h"
 
 // On disk format:
@@ -44,6 +50,10 @@ public:
 // Not tuned for extreme performance but should be reasonably fast.
 // Does not support keys or values larger than 2GB, which should be reasonable.
 // Keys must have non-zero length; values can have zero length.
+//
+// The file is memory mapped while it is read, and only the most recent entry for each key is
+// passed to the reader, so values which the reader doesn't look at are never read from disk.
+// If enough of the file is taken up by entries which have been replaced, it is compacted.
 
 // K and V are some POD type
 // K : the key type
@@ -58,59 +68,97 @@ public:
     // Since we're reading/writing directly to the storage of K instances,
     // K must be trivially copyable.
     static_assert(std::is_trivially_copyable<K>::value, "K must be a trivially copyable type");
+    // Values are passed to the reader straight from the mapped file, which has no alignment.
+    static_assert(alignof(V) == 1, "V must not require any alignment");
 
     // close any currently opened file
     Close();
     m_num_entries = 0;
 
-    // try opening for reading/writing
-    m_file.Open(filename, "r+b");
-
-    const u64 file_size = m_file.GetSize();
-
     m_header.Init();
-    if (m_file.IsOpen() && ValidateHeader())
+
+    File::MappedFile mapped_file(filename);
+    const std::span<const u8> data = mapped_file.GetData();
+    if (data.size() >= sizeof(Header) && !memcmp(&m_header, data.data(), sizeof(Header)))
     {
-      // good header, read some key/value pairs
-      K key;
+      // good header, index the key/value pairs
+      std::vector<Entry> entries;
+      std::unordered_map<std::string_view, size_t> index;
+      u64 stale_bytes = 0;
+      u64 offset = sizeof(Header);
+      while (true)
+      {
+        Entry entry;
+        entry.offset = offset;
+        if (data.size() - offset < sizeof(u32))
+          break;
+        std::memcpy(&entry.value_size, data.data() + offset, sizeof(u32));
 
-      std::unique_ptr<V[]> value = nullptr;
-      u32 value_size = 0;
-      u32 entry_number = 0;
-      u64 last_valid_value_start = m_file.Tell();
+        const u64 entry_size = EntrySize(entry.value_size);
+        if (entry_size > data.size() - offset)
+          break;
 
-      while (m_file.ReadArray(&value_size, 1))
-      {
-        const u64 next_extent = m_file.Tell() + sizeof(value_size) + value_size;
-        if (next_extent > file_size)
+        u32 entry_number;
+        std::memcpy(&entry_number, data.data() + offset + entry_size - sizeof(u32), sizeof(u32));
+        if (entry_number != entries.size() + 1)
           break;
 
-        // TODO: use make_unique_for_overwrite in C++20
-        value = std::unique_ptr<V[]>(new V[value_size]);
+        // Later entries replace earlier ones with the same key.
+        const std::string_view key_bytes(
+            reinterpret_cast<const char*>(data.data() + offset + sizeof(u32)), sizeof(K));
+        const auto [it, inserted] = index.try_emplace(key_bytes, entries.size());
+        if (!inserted)
+        {
+          Entry& replaced = entries[it->second];
+          replaced.live = false;
+          stale_bytes += EntrySize(replaced.value_size);
+          it->second = entries.size();
+        }
+
+        entries.push_back(entry);
+        offset += entry_size;
+      }
+
+      u32 num_live_entries = 0;
+      for (const Entry& entry : entries)
+      {
+        if (!entry.live)
+          continue;
 
-        // read key/value and pass to reader
-        if (m_file.ReadArray(&key, 1) && m_file.ReadArray(value.get(), value_size) &&
-            m_file.ReadArray(&entry_number, 1) && entry_number == m_num_entries + 1)
+        K key;
+        std::memcpy(&key, data.data() + entry.offset + sizeof(u32), sizeof(K));
+        reader.Read(key, GetValue(data, entry), entry.value_size);
+        num_live_entries++;
+      }
+
+      // Rewrite the file without the replaced entries once they take up a quarter of it.
+      m_num_entries = static_cast<u32>(entries.size());
+      if (stale_bytes >= COMPACTION_MIN_STALE_BYTES && stale_bytes * 4 >= offset &&
+          Compact(filename, data, entries))
+      {
+        // The file can't be replaced while it is mapped on Windows.
+        mapped_file.Close();
+        const std::string temp_filename = File::GetTempFilenameForAtomicWrite(filename);
+        if (File::Rename(temp_filename, filename))
         {
-          last_valid_value_start = m_file.Tell();
-          reader.Read(key, value.get(), value_size);
+          m_num_entries = num_live_entries;
+          offset -= stale_bytes;
         }
         else
         {
-          break;
+          File::Delete(temp_filename);
         }
-
-        m_num_entries++;
       }
-      m_file.ClearError();
-      m_file.Seek(last_valid_value_start, File::SeekOrigin::Begin);
+      mapped_file.Close();
 
-      return m_num_entries;
+      if (m_file.Open(filename, "r+b") && m_file.Seek(offset, File::SeekOrigin::Begin))
+        return num_live_entries;
     }
 
     // failed to open file for reading or bad header
     // close and recreate file
     Close();
+    m_num_entries = 0;
     m_file.Open(filename, "wb");
     WriteHeader();
     return 0;
@@ -128,23 +176,69 @@ public:
   {
     // TODO: Should do a check that we don't already have "key"? (I think each caller does that
     // already.)
-    m_file.WriteArray(&value_size, 1);
-    m_file.WriteArray(&key, 1);
-    m_file.WriteArray(value, value_size);
     m_num_entries++;
-    m_file.WriteArray(&m_num_entries, 1);
+    WriteEntry(m_file, &key, value, value_size, m_num_entries);
   }
 
 private:
-  void WriteHeader() { m_file.WriteArray(&m_header, 1); }
-  bool ValidateHeader()
+  // Files with fewer bytes than this in replaced entries are never compacted.
+  static constexpr u64 COMPACTION_MIN_STALE_BYTES = 1024 * 1024;
+
+  struct Entry
   {
-    char file_header[sizeof(Header)];
+    u64 offset;
+    u32 value_size;
+    bool live = true;
+  };
 
-    return (m_file.ReadArray(file_header, sizeof(Header)) &&
-            !memcmp((const char*)&m_header, file_header, sizeof(Header)));
+  static constexpr u64 EntrySize(u32 value_size)
+  {
+    return sizeof(u32) + sizeof(K) + u64(value_size) * sizeof(V) + sizeof(u32);
+  }
+
+  static const V* GetValue(std::span<const u8> data, const Entry& entry)
+  {
+    return reinterpret_cast<const V*>(data.data() + entry.offset + sizeof(u32) + sizeof(K));
   }
 
+  static void WriteEntry(File::IOFile& file, const void* key, const V* value, u32 value_size,
+                         u32 entry_number)
+  {
+    file.WriteArray(&value_size, 1);
+    file.WriteBytes(key, sizeof(K));
+    file.WriteArray(value, value_size);
+    file.WriteArray(&entry_number, 1);
+  }
+
+  // Writes the live entries to a temporary file next to the cache, renumbering them.
+  bool Compact(const std::string& filename, std::span<const u8> data,
+               const std::vector<Entry>& entries) const
+  {
+    const std::string temp_filename = File::GetTempFilenameForAtomicWrite(filename);
+    File::IOFile temp_file(temp_filename, "wb");
+    temp_file.WriteArray(&m_header, 1);
+
+    u32 entry_number = 0;
+    for (const Entry& entry : entries)
+    {
+      if (entry.live)
+      {
+        WriteEntry(temp_file, data.data() + entry.offset + sizeof(u32), GetValue(data, entry),
+                   entry.value_size, ++entry_number);
+      }
+    }
+
+    if (!temp_file.Close())
+    {
+      File::Delete(temp_filename);
+      return false;
+    }
+
+    return true;
+  }
+
+  void WriteHeader() { m_file.WriteArray(&m_header, 1); }
+
   struct Header
   {
     void Init()
@@ -0,0 +1,128 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/MappedFile.h"
+
+#include <cstdint>
+
+#ifdef _WIN32
+#include <windows.h>
+
+#include "Common/StringUtil.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "Common/CommonFuncs.h"
+#include "Common/Logging/Log.h"
+
+namespace File
+{
+MappedFile::MappedFile(const std::string& filename)
+{
+  Open(filename);
+}
+
+MappedFile::~MappedFile()
+{
+  Close();
+}
+
+#ifdef _WIN32
+bool MappedFile::Open(const std::string& filename)
+{
+  Close();
+
+  const HANDLE file = CreateFileW(UTF8ToWString(filename).c_str(), GENERIC_READ,
+                                  FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+    return false;
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size) || size.QuadPart == 0 ||
+      static_cast<u64>(size.QuadPart) > SIZE_MAX)
+  {
+    CloseHandle(file);
+    return false;
+  }
+
+  // The mapping keeps its own reference to the file.
+  const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  CloseHandle(file);
+  if (!mapping)
+  {
+    ERROR_LOG_FMT(COMMON, "Failed to create file mapping for {}: {}", filename,
+                  Common::GetLastErrorString());
+    return false;
+  }
+
+  void* const data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (!data)
+  {
+    ERROR_LOG_FMT(COMMON, "Failed to map {}: {}", filename, Common::GetLastErrorString());
+    CloseHandle(mapping);
+    return false;
+  }
+
+  m_mapping = mapping;
+  m_data = static_cast<const u8*>(data);
+  m_size = static_cast<size_t>(size.QuadPart);
+  return true;
+}
+
+void MappedFile::Close()
+{
+  if (m_data)
+    UnmapViewOfFile(m_data);
+  if (m_mapping)
+    CloseHandle(m_mapping);
+
+  m_data = nullptr;
+  m_size = 0;
+  m_mapping = nullptr;
+}
+#else
+bool MappedFile::Open(const std::string& filename)
+{
+  Close();
+
+  const int fd = open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0)
+    return false;
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size <= 0 || static_cast<u64>(st.st_size) > SIZE_MAX)
+  {
+    close(fd);
+    return false;
+  }
+
+  // The mapping stays valid after the descriptor is closed.
+  const size_t size = static_cast<size_t>(st.st_size);
+  void* const data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED)
+  {
+    ERROR_LOG_FMT(COMMON, "Failed to map {}: {}", filename, Common::LastStrerrorString());
+    return false;
+  }
+
+  m_data = static_cast<const u8*>(data);
+  m_size = size;
+  return true;
+}
+
+void MappedFile::Close()
+{
+  if (m_data)
+    munmap(const_cast<u8*>(m_data), m_size);
+
+  m_data = nullptr;
+  m_size = 0;
+}
+#endif
+}  // namespace File
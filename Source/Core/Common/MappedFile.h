@@ -0,0 +1,40 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <span>
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+namespace File
+{
+// Read-only view of the whole contents of a file, mapped into memory so that only the pages
+// which are actually accessed get read from disk. Changes made to the file while it is mapped
+// may or may not be visible through the view, and writes beyond the mapped size never are.
+class MappedFile
+{
+public:
+  MappedFile() = default;
+  explicit MappedFile(const std::string& filename);
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  // Fails for empty files, as they can't be mapped.
+  bool Open(const std::string& filename);
+  void Close();
+
+  bool IsOpen() const { return m_data != nullptr; }
+  std::span<const u8> GetData() const { return {m_data, m_size}; }
+
+private:
+  const u8* m_data = nullptr;
+  size_t m_size = 0;
+#ifdef _WIN32
+  void* m_mapping = nullptr;
+#endif
+};
+}  // namespace File
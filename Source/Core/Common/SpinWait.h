@@ -0,0 +1,162 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+
+#include "Common/CommonTypes.h"
+#include "Common/Event.h"
+#include "Common/Intrinsics.h"
+
+#ifdef _M_ARM_64
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <arm_acle.h>
+#endif
+#endif
+
+namespace Common
+{
+// Tells the CPU that the current thread is busy-waiting.
+inline void SpinPause()
+{
+#if defined(_M_X86)
+  _mm_pause();
+#elif defined(_M_ARM_64)
+  __yield();
+#endif
+}
+
+// Lets a thread spin for a short while before it goes to sleep waiting for another thread, so
+// that short waits don't cost a sleep and a wakeup syscall. The spin time adapts to how long
+// recent waits took: if they are usually longer than the maximum spin time, spinning would only
+// waste CPU time and is skipped until waits become short again.
+//
+// Spin() and OnSleepEnd() must only be called by the waiting thread. OnSignal() and GetStats()
+// may be called from any thread.
+class AdaptiveSpinWait
+{
+public:
+  struct Stats
+  {
+    // Waits which ended while spinning.
+    u64 spin_wakeups;
+    // Waits which had to sleep.
+    u64 sleep_wakeups;
+    // Time between the waiting thread being signalled and it running again, for the waits
+    // which had to sleep.
+    u64 total_wakeup_latency_ns;
+    u64 max_wakeup_latency_ns;
+  };
+
+  explicit AdaptiveSpinWait(std::chrono::nanoseconds max_spin = std::chrono::microseconds(20))
+      : m_max_spin_ns(static_cast<u64>(max_spin.count()))
+  {
+  }
+
+  // Spins until ready() returns true, for at most as long as the current waits are expected to
+  // take. Returns false if the caller has to sleep, in which case it must call OnSleepEnd() once
+  // it is running again.
+  template <typename F>
+  bool Spin(F ready)
+  {
+    m_wait_start = Now();
+
+    // Spin for twice the average wait, so that most of the waits finish while spinning.
+    const u64 spin_ns = m_average_wait_ns <= m_max_spin_ns ?
+                            std::min(m_average_wait_ns * 2, m_max_spin_ns) :
+                            0;
+    const u64 deadline = m_wait_start + spin_ns;
+    for (u32 i = 0;; i++)
+    {
+      if (ready())
+      {
+        // The wake is consumed here, so its signal time must not be used by the next sleep.
+        m_signal_time.store(0, std::memory_order_relaxed);
+        m_spin_wakeups.fetch_add(1, std::memory_order_relaxed);
+        RecordWait(Now() - m_wait_start);
+        return true;
+      }
+
+      // Reading the clock is much more expensive than checking ready().
+      if (i % 64 == 0 && Now() >= deadline)
+        return false;
+
+      SpinPause();
+    }
+  }
+
+  void OnSleepEnd()
+  {
+    const u64 now = Now();
+    m_sleep_wakeups.fetch_add(1, std::memory_order_relaxed);
+
+    // The sleep may have ended because of a timeout instead of a signal. A signal from before the
+    // wait started belongs to a wake which was already seen while spinning, which the signalling
+    // thread recorded after the spin had ended.
+    const u64 signal_time = m_signal_time.exchange(0, std::memory_order_relaxed);
+    if (signal_time < m_wait_start || signal_time > now)
+    {
+      RecordWait(now - m_wait_start);
+      return;
+    }
+
+    // Only count the time until the signal, as spinning would have avoided the wakeup latency.
+    RecordWait(signal_time - m_wait_start);
+
+    const u64 latency = now - signal_time;
+    m_total_wakeup_latency_ns.fetch_add(latency, std::memory_order_relaxed);
+    if (latency > m_max_wakeup_latency_ns.load(std::memory_order_relaxed))
+      m_max_wakeup_latency_ns.store(latency, std::memory_order_relaxed);
+  }
+
+  // Should be called right before waking up the waiting thread, to measure the wakeup latency.
+  void OnSignal() { m_signal_time.store(Now(), std::memory_order_relaxed); }
+
+  // Waits for the event, spinning on it first.
+  void Wait(Event& event)
+  {
+    if (Spin([&] { return event.TryWait(); }))
+      return;
+
+    event.Wait();
+    OnSleepEnd();
+  }
+
+  Stats GetStats() const
+  {
+    return {m_spin_wakeups.load(std::memory_order_relaxed),
+            m_sleep_wakeups.load(std::memory_order_relaxed),
+            m_total_wakeup_latency_ns.load(std::memory_order_relaxed),
+            m_max_wakeup_latency_ns.load(std::memory_order_relaxed)};
+  }
+
+private:
+  static u64 Now()
+  {
+    return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now().time_since_epoch())
+                                .count());
+  }
+
+  void RecordWait(u64 wait_ns)
+  {
+    // Exponential moving average, so that the spin time follows changes in the workload.
+    m_average_wait_ns = (m_average_wait_ns * 7 + wait_ns) / 8;
+  }
+
+  const u64 m_max_spin_ns;
+  u64 m_wait_start = 0;
+  u64 m_average_wait_ns = 0;
+
+  std::atomic<u64> m_signal_time{0};
+  std::atomic<u64> m_spin_wakeups{0};
+  std::atomic<u64> m_sleep_wakeups{0};
+  std::atomic<u64> m_total_wakeup_latency_ns{0};
+  std::atomic<u64> m_max_wakeup_latency_ns{0};
+};
+}  // namespace Common
@@ -0,0 +1,191 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Event.h"
+#include "Common/Thread.h"
+
+// A fixed set of worker threads that execute tasks in the order they were pushed.
+
+namespace Common
+{
+class ThreadPool
+{
+public:
+  using Task = std::function<void()>;
+
+  ThreadPool() = default;
+  ThreadPool(const std::string_view name, u32 num_threads) { Reset(name, num_threads); }
+  ~ThreadPool() { Shutdown(); }
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  // Shuts the current workers down (if any) and starts num_threads new ones.
+  void Reset(const std::string_view name, u32 num_threads)
+  {
+    Shutdown();
+    std::lock_guard lg(m_lock);
+    m_shutdown = false;
+    m_cancelling = false;
+    m_pending = 0;
+    m_threads.reserve(num_threads);
+    for (u32 i = 0; i < num_threads; i++)
+      m_threads.emplace_back(&ThreadPool::ThreadLoop, this, fmt::format("{} {}", name, i));
+  }
+
+  // Tells the workers to shut down when the queue is empty, and blocks until they exit.
+  // If cancel is true, queued tasks which have not started yet are discarded.
+  void Shutdown(bool cancel = false)
+  {
+    {
+      std::lock_guard lg(m_lock);
+      if (m_shutdown || m_threads.empty())
+        return;
+
+      if (cancel)
+      {
+        m_cancelling = true;
+        m_pending -= static_cast<u32>(m_tasks.size());
+        m_tasks = std::queue<Task>();
+      }
+
+      m_shutdown = true;
+      m_worker_cond_var.notify_all();
+    }
+
+    for (std::thread& thread : m_threads)
+      thread.join();
+    m_threads.clear();
+  }
+
+  u32 GetThreadCount() const { return static_cast<u32>(m_threads.size()); }
+  bool IsRunning() const { return !m_threads.empty(); }
+
+  // Adds a task to the queue. If the pool has no workers, the task runs on the calling thread.
+  void Push(Task task)
+  {
+    {
+      std::lock_guard lg(m_lock);
+      if (!m_threads.empty())
+      {
+        if (m_shutdown)
+          return;
+
+        m_tasks.push(std::move(task));
+        m_pending++;
+        m_worker_cond_var.notify_one();
+        return;
+      }
+    }
+
+    task();
+  }
+
+  // Blocks until every task pushed so far has finished.
+  void WaitForCompletion()
+  {
+    std::unique_lock lg(m_lock);
+    m_wait_cond_var.wait(lg, [&] { return m_pending == 0; });
+  }
+
+  // Calls func(i) for every i in [0, count), spreading the calls over the workers and the calling
+  // thread, and returns once all of them have finished. Calls for different indices may run
+  // concurrently, so func must only touch state that is private to its index.
+  template <typename Func>
+  void ParallelFor(u32 count, Func&& func)
+  {
+    if (count == 0)
+      return;
+
+    const u32 num_helpers = std::min(GetThreadCount(), count - 1);
+    if (num_helpers == 0)
+    {
+      for (u32 i = 0; i < count; i++)
+        func(i);
+      return;
+    }
+
+    // Helpers may only get scheduled after the calling thread has already done all of the work,
+    // so the shared state has to outlive this function.
+    struct State
+    {
+      std::atomic<u32> next_index{0};
+      std::atomic<u32> remaining;
+      Common::Event done;
+    };
+    auto state = std::make_shared<State>();
+    state->remaining.store(count, std::memory_order_relaxed);
+
+    auto run = [state, count, &func] {
+      for (u32 i = state->next_index.fetch_add(1, std::memory_order_relaxed); i < count;
+           i = state->next_index.fetch_add(1, std::memory_order_relaxed))
+      {
+        func(i);
+        if (state->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+          state->done.Set();
+      }
+    };
+
+    for (u32 i = 0; i < num_helpers; i++)
+      Push(run);
+    run();
+
+    // func is captured by reference, but helpers which start after this point never call it.
+    state->done.Wait();
+  }
+
+  // If a task polls IsCancelling(), it can abort its work when the pool is being cancelled.
+  bool IsCancelling() const { return m_cancelling.load(); }
+
+private:
+  void ThreadLoop(const std::string name)
+  {
+    Common::SetCurrentThreadName(name.c_str());
+
+    while (true)
+    {
+      std::unique_lock lg(m_lock);
+      m_worker_cond_var.wait(lg, [&] { return !m_tasks.empty() || m_shutdown; });
+      if (m_tasks.empty())
+        return;
+
+      Task task{std::move(m_tasks.front())};
+      m_tasks.pop();
+      lg.unlock();
+
+      task();
+
+      lg.lock();
+      if (--m_pending == 0)
+        m_wait_cond_var.notify_all();
+    }
+  }
+
+  std::vector<std::thread> m_threads;
+  std::mutex m_lock;
+  std::queue<Task> m_tasks;
+  std::condition_variable m_wait_cond_var;
+  std::condition_variable m_worker_cond_var;
+  std::atomic<bool> m_cancelling = false;
+  u32 m_pending = 0;
+  bool m_shutdown = false;
+};
+
+}  // namespace Common
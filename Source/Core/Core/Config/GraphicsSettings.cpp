@@ -54,6 +54,8 @@ const Info<int> GFX_TEXTURE_PNG_COMPRESSION_LEVEL{
     {System::GFX, "Settings", "TexturePNGCompressionLevel"}, 6};
 const Info<bool> GFX_HIRES_TEXTURES{{System::GFX, "Settings", "HiresTextures"}, false};
 const Info<bool> GFX_CACHE_HIRES_TEXTURES{{System::GFX, "Settings", "CacheHiresTextures"}, false};
+const Info<bool> GFX_PREFETCH_HIRES_TEXTURES{{System::GFX, "Settings", "PrefetchHiresTextures"},
+                                             true};
 const Info<bool> GFX_DUMP_EFB_TARGET{{System::GFX, "Settings", "DumpEFBTarget"}, false};
 const Info<bool> GFX_DUMP_XFB_TARGET{{System::GFX, "Settings", "DumpXFBTarget"}, false};
 const Info<bool> GFX_DUMP_FRAMES_AS_IMAGES{{System::GFX, "Settings", "DumpFramesAsImages"}, false};
@@ -97,11 +99,19 @@ const Info<ShaderCompilationMode> GFX_SHADER_COMPILATION_MODE{
 const Info<int> GFX_SHADER_COMPILER_THREADS{{System::GFX, "Settings", "ShaderCompilerThreads"}, 1};
 const Info<int> GFX_SHADER_PRECOMPILER_THREADS{
     {System::GFX, "Settings", "ShaderPrecompilerThreads"}, -1};
+const Info<bool> GFX_PREWARM_SHARED_PIPELINES{
+    {System::GFX, "Settings", "PrewarmSharedPipelines"}, false};
 const Info<bool> GFX_SAVE_TEXTURE_CACHE_TO_STATE{
     {System::GFX, "Settings", "SaveTextureCacheToState"}, true};
 const Info<bool> GFX_PREFER_VS_FOR_LINE_POINT_EXPANSION{
     {System::GFX, "Settings", "PreferVSForLinePointExpansion"}, false};
 const Info<bool> GFX_CPU_CULL{{System::GFX, "Settings", "CPUCull"}, false};
+const Info<int> GFX_VERTEX_LOADER_THREADS{{System::GFX, "Settings", "VertexLoaderThreads"}, 0};
+const Info<bool> GFX_VERTEX_DECODE_CACHE{{System::GFX, "Settings", "VertexDecodeCache"}, false};
+const Info<bool> GFX_DISPLAY_LIST_CACHE{{System::GFX, "Settings", "DisplayListCache"}, false};
+const Info<int> GFX_TEXTURE_CACHE_BUDGET{{System::GFX, "Settings", "TextureCacheBudget"}, 0};
+const Info<int> GFX_TEXTURE_DECODING_THREADS{{System::GFX, "Settings", "TextureDecodingThreads"},
+                                             0};
 
 const Info<TriState> GFX_MTL_MANUALLY_UPLOAD_BUFFERS{
     {System::GFX, "Settings", "ManuallyUploadBuffers"}, TriState::Auto};
@@ -112,6 +122,8 @@ const Info<bool> GFX_SW_DUMP_OBJECTS{{System::GFX, "Settings", "SWDumpObjects"},
 const Info<bool> GFX_SW_DUMP_TEV_STAGES{{System::GFX, "Settings", "SWDumpTevStages"}, false};
 const Info<bool> GFX_SW_DUMP_TEV_TEX_FETCHES{{System::GFX, "Settings", "SWDumpTevTexFetches"},
                                              false};
+const Info<std::string> GFX_SW_SHARED_MEMORY_OUTPUT{
+    {System::GFX, "Settings", "SWSharedMemoryOutput"}, ""};
 
 const Info<bool> GFX_PREFER_GLES{{System::GFX, "Settings", "PreferGLES"}, false};
 
@@ -178,6 +190,8 @@ const Info<bool> GFX_HACK_SKIP_EFB_COPY_TO_RAM{{System::GFX, "Hacks", "EFBToText
 const Info<bool> GFX_HACK_SKIP_XFB_COPY_TO_RAM{{System::GFX, "Hacks", "XFBToTextureEnable"}, true};
 const Info<bool> GFX_HACK_DISABLE_COPY_TO_VRAM{{System::GFX, "Hacks", "DisableCopyToVRAM"}, false};
 const Info<bool> GFX_HACK_DEFER_EFB_COPIES{{System::GFX, "Hacks", "DeferEFBCopies"}, true};
+const Info<int> GFX_HACK_EFB_COPY_READBACK_LATENCY{
+    {System::GFX, "Hacks", "EFBCopyReadbackLatency"}, 0};
 const Info<bool> GFX_HACK_IMMEDIATE_XFB{{System::GFX, "Hacks", "ImmediateXFBEnable"}, false};
 const Info<bool> GFX_HACK_SKIP_DUPLICATE_XFBS{{System::GFX, "Hacks", "SkipDuplicateXFBs"}, true};
 const Info<bool> GFX_HACK_EARLY_XFB_OUTPUT{{System::GFX, "Hacks", "EarlyXFBOutput"}, true};
@@ -54,6 +54,7 @@ extern const Info<bool> GFX_DUMP_BASE_TEXTURES;
 extern const Info<int> GFX_TEXTURE_PNG_COMPRESSION_LEVEL;
 extern const Info<bool> GFX_HIRES_TEXTURES;
 extern const Info<bool> GFX_CACHE_HIRES_TEXTURES;
+extern const Info<bool> GFX_PREFETCH_HIRES_TEXTURES;
 extern const Info<bool> GFX_DUMP_EFB_TARGET;
 extern const Info<bool> GFX_DUMP_XFB_TARGET;
 extern const Info<bool> GFX_DUMP_FRAMES_AS_IMAGES;
@@ -86,9 +87,15 @@ extern const Info<bool> GFX_WAIT_FOR_SHADERS_BEFORE_STARTING;
 extern const Info<ShaderCompilationMode> GFX_SHADER_COMPILATION_MODE;
 extern const Info<int> GFX_SHADER_COMPILER_THREADS;
 extern const Info<int> GFX_SHADER_PRECOMPILER_THREADS;
+extern const Info<bool> GFX_PREWARM_SHARED_PIPELINES;
 extern const Info<bool> GFX_SAVE_TEXTURE_CACHE_TO_STATE;
 extern const Info<bool> GFX_PREFER_VS_FOR_LINE_POINT_EXPANSION;
 extern const Info<bool> GFX_CPU_CULL;
+extern const Info<int> GFX_VERTEX_LOADER_THREADS;
+extern const Info<bool> GFX_VERTEX_DECODE_CACHE;
+extern const Info<bool> GFX_DISPLAY_LIST_CACHE;
+extern const Info<int> GFX_TEXTURE_CACHE_BUDGET;
+extern const Info<int> GFX_TEXTURE_DECODING_THREADS;
 
 extern const Info<TriState> GFX_MTL_MANUALLY_UPLOAD_BUFFERS;
 extern const Info<TriState> GFX_MTL_USE_PRESENT_DRAWABLE;
@@ -96,6 +103,7 @@ extern const Info<TriState> GFX_MTL_USE_PRESENT_DRAWABLE;
 extern const Info<bool> GFX_SW_DUMP_OBJECTS;
 extern const Info<bool> GFX_SW_DUMP_TEV_STAGES;
 extern const Info<bool> GFX_SW_DUMP_TEV_TEX_FETCHES;
+extern const Info<std::string> GFX_SW_SHARED_MEMORY_OUTPUT;
 
 extern const Info<bool> GFX_PREFER_GLES;
 
@@ -157,6 +165,7 @@ extern const Info<bool> GFX_HACK_SKIP_EFB_COPY_TO_RAM;
 extern const Info<bool> GFX_HACK_SKIP_XFB_COPY_TO_RAM;
 extern const Info<bool> GFX_HACK_DISABLE_COPY_TO_VRAM;
 extern const Info<bool> GFX_HACK_DEFER_EFB_COPIES;
+extern const Info<int> GFX_HACK_EFB_COPY_READBACK_LATENCY;
 extern const Info<bool> GFX_HACK_IMMEDIATE_XFB;
 extern const Info<bool> GFX_HACK_SKIP_DUPLICATE_XFBS;
 extern const Info<bool> GFX_HACK_EARLY_XFB_OUTPUT;
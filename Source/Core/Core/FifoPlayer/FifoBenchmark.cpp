@@ -0,0 +1,156 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/FifoPlayer/FifoBenchmark.h"
+
+#include <algorithm>
+#include <utility>
+
+#include <picojson.h>
+
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Common/Version.h"
+
+#include "Core/Config/MainSettings.h"
+
+#include "VideoCommon/Statistics.h"
+#include "VideoCommon/VideoEvents.h"
+
+static picojson::value NanosecondsToMicroseconds(u64 ns)
+{
+  return picojson::value(static_cast<double>(ns) / 1000.0);
+}
+
+FifoBenchmark::FifoBenchmark(const Options& options) : m_options(options)
+{
+  m_options.loops = std::max(m_options.loops, 1u);
+  g_stats.collect_timings = true;
+}
+
+FifoBenchmark::~FifoBenchmark()
+{
+  g_stats.collect_timings = false;
+}
+
+void FifoBenchmark::Start(u32 first_frame, u32 last_frame)
+{
+  std::lock_guard lk(m_lock);
+  m_first_frame = first_frame;
+  m_last_frame = last_frame;
+  m_frames.clear();
+  m_frames.reserve(size_t(m_last_frame - m_first_frame + 1) * m_options.loops);
+  m_frame_start = std::chrono::steady_clock::now();
+
+  m_frame_event = AfterFrameEvent::Register([this] { OnFrameEnd(); }, "FifoBenchmark");
+}
+
+void FifoBenchmark::OnFrameStart()
+{
+  std::lock_guard lk(m_lock);
+  m_frame_start = std::chrono::steady_clock::now();
+
+  // Loading the initial state and the end of the previous frame don't count towards this frame
+  g_stats.timings = {};
+}
+
+bool FifoBenchmark::OnLoopFinished()
+{
+  return ++m_loops_finished >= m_options.loops;
+}
+
+// Called on the GPU thread
+void FifoBenchmark::OnFrameEnd()
+{
+  const auto now = std::chrono::steady_clock::now();
+  const Statistics::Timings timings = std::exchange(g_stats.timings, {});
+
+  std::lock_guard lk(m_lock);
+  m_frames.push_back({
+      .wall_time = static_cast<u64>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_frame_start).count()),
+      .vertex_loader_time = timings.vertex_loader_time,
+      .texture_decode_time = timings.texture_decode_time,
+      .shader_compile_stall_time = timings.shader_compile_stall_time,
+      .num_shader_compile_stalls = static_cast<u32>(timings.num_shader_compile_stalls),
+  });
+}
+
+bool FifoBenchmark::WriteReport(const std::string& path, const std::string& fifolog_path) const
+{
+  std::lock_guard lk(m_lock);
+
+  // Frames are counted as they are presented by the GPU thread, which matches the frames of the
+  // fifolog as each of them ends with an XFB copy.
+  const u32 frames_per_loop = m_last_frame - m_first_frame + 1;
+
+  picojson::array json_frames;
+  std::vector<u64> wall_times;
+  wall_times.reserve(m_frames.size());
+  FrameTiming total{};
+  for (size_t i = 0; i < m_frames.size(); i++)
+  {
+    const FrameTiming& frame = m_frames[i];
+    picojson::object json_frame;
+    json_frame["loop"] = picojson::value(static_cast<double>(i / frames_per_loop));
+    json_frame["frame"] =
+        picojson::value(static_cast<double>(m_first_frame + i % frames_per_loop));
+    json_frame["wall_time_us"] = NanosecondsToMicroseconds(frame.wall_time);
+    json_frame["vertex_loader_time_us"] = NanosecondsToMicroseconds(frame.vertex_loader_time);
+    json_frame["texture_decode_time_us"] = NanosecondsToMicroseconds(frame.texture_decode_time);
+    json_frame["shader_compile_stall_time_us"] =
+        NanosecondsToMicroseconds(frame.shader_compile_stall_time);
+    json_frame["shader_compile_stalls"] =
+        picojson::value(static_cast<double>(frame.num_shader_compile_stalls));
+    json_frames.emplace_back(std::move(json_frame));
+
+    wall_times.push_back(frame.wall_time);
+    total.wall_time += frame.wall_time;
+    total.vertex_loader_time += frame.vertex_loader_time;
+    total.texture_decode_time += frame.texture_decode_time;
+    total.shader_compile_stall_time += frame.shader_compile_stall_time;
+    total.num_shader_compile_stalls += frame.num_shader_compile_stalls;
+  }
+
+  picojson::object json_summary;
+  json_summary["frames"] = picojson::value(static_cast<double>(m_frames.size()));
+  json_summary["total_wall_time_us"] = NanosecondsToMicroseconds(total.wall_time);
+  json_summary["total_vertex_loader_time_us"] =
+      NanosecondsToMicroseconds(total.vertex_loader_time);
+  json_summary["total_texture_decode_time_us"] =
+      NanosecondsToMicroseconds(total.texture_decode_time);
+  json_summary["total_shader_compile_stall_time_us"] =
+      NanosecondsToMicroseconds(total.shader_compile_stall_time);
+  json_summary["shader_compile_stalls"] =
+      picojson::value(static_cast<double>(total.num_shader_compile_stalls));
+  if (!wall_times.empty())
+  {
+    std::sort(wall_times.begin(), wall_times.end());
+    json_summary["mean_wall_time_us"] =
+        NanosecondsToMicroseconds(total.wall_time / wall_times.size());
+    json_summary["median_wall_time_us"] =
+        NanosecondsToMicroseconds(wall_times[wall_times.size() / 2]);
+    json_summary["p99_wall_time_us"] =
+        NanosecondsToMicroseconds(wall_times[(wall_times.size() - 1) * 99 / 100]);
+    json_summary["max_wall_time_us"] = NanosecondsToMicroseconds(wall_times.back());
+  }
+
+  picojson::object json_root;
+  json_root["version"] = picojson::value(Common::GetScmDescStr());
+  json_root["fifolog"] = picojson::value(fifolog_path);
+  json_root["video_backend"] = picojson::value(Config::Get(Config::MAIN_GFX_BACKEND));
+  json_root["dual_core"] = picojson::value(Config::Get(Config::MAIN_CPU_THREAD));
+  json_root["first_frame"] = picojson::value(static_cast<double>(m_first_frame));
+  json_root["last_frame"] = picojson::value(static_cast<double>(m_last_frame));
+  json_root["loops"] = picojson::value(static_cast<double>(m_loops_finished));
+  json_root["frames"] = picojson::value(std::move(json_frames));
+  json_root["summary"] = picojson::value(std::move(json_summary));
+
+  if (!File::WriteStringToFile(path, picojson::value(json_root).serialize(true)))
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to write benchmark report to {}", path);
+    return false;
+  }
+
+  return true;
+}
@@ -0,0 +1,75 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/HookableEvent.h"
+
+// Replays a range of frames from a fifolog a number of times, and records how long each frame
+// took along with the time spent in the vertex loaders, in texture decoding and in shader
+// compilation stalls. Used to compare the performance of the video code between builds and
+// settings with a fixed set of fifologs.
+class FifoBenchmark
+{
+public:
+  struct Options
+  {
+    u32 first_frame = 0;
+    // The last frame of the fifolog if not set.
+    std::optional<u32> last_frame;
+    u32 loops = 1;
+  };
+
+  explicit FifoBenchmark(const Options& options);
+  ~FifoBenchmark();
+
+  FifoBenchmark(const FifoBenchmark&) = delete;
+  FifoBenchmark& operator=(const FifoBenchmark&) = delete;
+
+  const Options& GetOptions() const { return m_options; }
+
+  // Called by the FifoPlayer on the CPU thread before the first frame is played, with the frame
+  // range which will actually be played.
+  void Start(u32 first_frame, u32 last_frame);
+
+  // Called by the FifoPlayer on the CPU thread right before it writes the first command of a frame.
+  // The GPU is idle at that point, as the previous frame has been fully processed.
+  void OnFrameStart();
+
+  // Called by the FifoPlayer on the CPU thread whenever the whole frame range has been played.
+  // Returns true once all loops are done.
+  bool OnLoopFinished();
+
+  // Writes the results to a JSON file. Should be called after emulation has stopped.
+  bool WriteReport(const std::string& path, const std::string& fifolog_path) const;
+
+private:
+  struct FrameTiming
+  {
+    u64 wall_time;
+    u64 vertex_loader_time;
+    u64 texture_decode_time;
+    u64 shader_compile_stall_time;
+    u32 num_shader_compile_stalls;
+  };
+
+  void OnFrameEnd();
+
+  Options m_options;
+  u32 m_first_frame = 0;
+  u32 m_last_frame = 0;
+  u32 m_loops_finished = 0;
+
+  mutable std::mutex m_lock;
+  std::vector<FrameTiming> m_frames;
+  std::chrono::steady_clock::time_point m_frame_start;
+
+  Common::EventHook m_frame_event;
+};
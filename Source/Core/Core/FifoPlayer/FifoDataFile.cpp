@@ -5,22 +5,32 @@
 
 #include <algorithm>
 #include <cstring>
+#include <map>
 #include <memory>
+#include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include <zstd.h>
+
+#include "Common/Crypto/SHA1.h"
 #include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
 
 constexpr u32 FILE_ID = 0x0d01f1f0;
-constexpr u32 VERSION_NUMBER = 5;
-constexpr u32 MIN_LOADER_VERSION = 1;
-// This value is only used if the DFF file was created with overridden RAM sizes.
-// If the MIN_LOADER_VERSION ever exceeds this, it's alright to remove it.
-constexpr u32 MIN_LOADER_VERSION_FOR_RAM_OVERRIDE = 5;
+constexpr u32 VERSION_NUMBER = 6;
+// Frames are compressed since version 6.
+constexpr u32 MIN_LOADER_VERSION = 6;
+
+constexpr int COMPRESSION_LEVEL = 3;
+// Number of frames which are kept in memory after they have been loaded, for files which are
+// streamed.
+constexpr size_t FRAME_CACHE_SIZE = 8;
 
 #pragma pack(push, 1)
 
@@ -62,6 +72,22 @@ struct FileFrameInfo
 };
 static_assert(sizeof(FileFrameInfo) == 64, "FileFrameInfo should be 64 bytes");
 
+// Used since version 6. The fifo data and the list of memory updates of each frame are compressed
+// separately, and are loaded while the fifolog is being played back.
+struct FileFrameInfoV6
+{
+  u64 fifoDataOffset;
+  u32 fifoDataCompressedSize;
+  u32 fifoDataSize;
+  u32 fifoStart;
+  u32 fifoEnd;
+  u64 memoryUpdatesOffset;
+  u32 memoryUpdatesCompressedSize;
+  u32 numMemoryUpdates;
+  u8 reserved[24];
+};
+static_assert(sizeof(FileFrameInfoV6) == 64, "FileFrameInfoV6 should be 64 bytes");
+
 struct FileMemoryUpdate
 {
   u32 fifoPosition;
@@ -75,6 +101,78 @@ static_assert(sizeof(FileMemoryUpdate) == 24, "FileMemoryUpdate should be 24 byt
 
 #pragma pack(pop)
 
+// Since version 6, the dataOffset of a FileMemoryUpdate points to the compressed size as a u32,
+// followed by the compressed data. Memory updates with the same data share it. The data is looked
+// up by its SHA-1 and size, so that the frames which were written don't have to stay in memory.
+using WrittenDataMap = std::map<std::pair<Common::SHA1::Digest, u32>, u64>;
+
+static std::optional<std::vector<u8>> Compress(const u8* data, size_t size)
+{
+  std::vector<u8> buffer(ZSTD_compressBound(size));
+  const size_t compressed_size =
+      ZSTD_compress(buffer.data(), buffer.size(), data, size, COMPRESSION_LEVEL);
+  if (ZSTD_isError(compressed_size))
+  {
+    ERROR_LOG_FMT(CORE, "Failed to compress FIFO data: {}", ZSTD_getErrorName(compressed_size));
+    return std::nullopt;
+  }
+
+  buffer.resize(compressed_size);
+  return buffer;
+}
+
+static bool ReadCompressed(File::IOFile& file, u32 compressed_size, u8* data, size_t size)
+{
+  std::vector<u8> buffer(compressed_size);
+  if (!file.ReadBytes(buffer.data(), buffer.size()))
+    return false;
+
+  return ZSTD_decompress(data, size, buffer.data(), buffer.size()) == size;
+}
+
+static std::optional<u64> WriteCompressedMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates,
+                                                       WrittenDataMap& written_data,
+                                                       u32* compressed_size, File::IOFile& file)
+{
+  std::vector<FileMemoryUpdate> dstUpdates(memUpdates.size());
+  for (size_t i = 0; i < memUpdates.size(); ++i)
+  {
+    const MemoryUpdate& srcUpdate = memUpdates[i];
+    const u32 size = static_cast<u32>(srcUpdate.data.size());
+    const auto [iter, inserted] =
+        written_data.try_emplace({Common::SHA1::CalculateDigest(srcUpdate.data), size});
+    if (inserted)
+    {
+      const auto compressed = Compress(srcUpdate.data.data(), size);
+      if (!compressed)
+        return std::nullopt;
+
+      const u32 data_compressed_size = static_cast<u32>(compressed->size());
+      iter->second = file.Tell();
+      file.WriteBytes(&data_compressed_size, sizeof(u32));
+      file.WriteBytes(compressed->data(), compressed->size());
+    }
+
+    FileMemoryUpdate& dstUpdate = dstUpdates[i];
+    dstUpdate = {};
+    dstUpdate.address = srcUpdate.address;
+    dstUpdate.dataOffset = iter->second;
+    dstUpdate.dataSize = size;
+    dstUpdate.fifoPosition = srcUpdate.fifoPosition;
+    dstUpdate.type = static_cast<u8>(srcUpdate.type);
+  }
+
+  const auto compressed = Compress(reinterpret_cast<const u8*>(dstUpdates.data()),
+                                   dstUpdates.size() * sizeof(FileMemoryUpdate));
+  if (!compressed)
+    return std::nullopt;
+
+  const u64 offset = file.Tell();
+  file.WriteBytes(compressed->data(), compressed->size());
+  *compressed_size = static_cast<u32>(compressed->size());
+  return offset;
+}
+
 FifoDataFile::FifoDataFile() = default;
 
 FifoDataFile::~FifoDataFile() = default;
@@ -115,7 +213,7 @@ bool FifoDataFile::Save(const std::string& filename)
 
   // Add space for frame list
   u64 frameListOffset = file.Tell();
-  PadFile(m_Frames.size() * sizeof(FileFrameInfo), file);
+  PadFile(m_Frames.size() * sizeof(FileFrameInfoV6), file);
 
   u64 bpMemOffset = file.Tell();
   file.WriteArray(m_BPMem);
@@ -136,11 +234,7 @@ bool FifoDataFile::Save(const std::string& filename)
   FileHeader header;
   header.fileId = FILE_ID;
   header.file_version = VERSION_NUMBER;
-  // Maintain backwards compatability so long as the RAM sizes aren't overridden.
-  if (Config::Get(Config::MAIN_RAM_OVERRIDE_ENABLE))
-    header.min_loader_version = MIN_LOADER_VERSION_FOR_RAM_OVERRIDE;
-  else
-    header.min_loader_version = MIN_LOADER_VERSION;
+  header.min_loader_version = MIN_LOADER_VERSION;
 
   header.bpMemOffset = bpMemOffset;
   header.bpMemSize = BP_MEM_SIZE;
@@ -170,33 +264,53 @@ bool FifoDataFile::Save(const std::string& filename)
   file.Seek(0, File::SeekOrigin::Begin);
   file.WriteBytes(&header, sizeof(FileHeader));
 
-  // Write frames list
+  // Write frames list. Frames of files which are streamed are loaded one at a time, and the next
+  // one is loaded while the current one is compressed.
+  WrittenDataMap written_data;
   for (unsigned int i = 0; i < m_Frames.size(); ++i)
   {
-    const FifoFrameInfo& srcFrame = m_Frames[i];
+    const std::shared_ptr<const FifoFrameInfo> frame = GetFrame(i);
+    if (i + 1 < m_Frames.size())
+      PrefetchFrame(i + 1);
+    const FifoFrameInfo& srcFrame = *frame;
+    // Don't write a frame which couldn't be loaded
+    if (!m_streamed_frames.empty() &&
+        srcFrame.fifoData.size() != m_streamed_frames[i].fifo_data_size)
+    {
+      return false;
+    }
 
     // Write FIFO data
     file.Seek(0, File::SeekOrigin::End);
     u64 dataOffset = file.Tell();
-    file.WriteBytes(srcFrame.fifoData.data(), srcFrame.fifoData.size());
-
-    u64 memoryUpdatesOffset = WriteMemoryUpdates(srcFrame.memoryUpdates, file);
-
-    FileFrameInfo dstFrame;
+    const auto compressedFifoData = Compress(srcFrame.fifoData.data(), srcFrame.fifoData.size());
+    if (!compressedFifoData)
+      return false;
+    file.WriteBytes(compressedFifoData->data(), compressedFifoData->size());
+
+    u32 memoryUpdatesCompressedSize;
+    const std::optional<u64> memoryUpdatesOffset = WriteCompressedMemoryUpdates(
+        srcFrame.memoryUpdates, written_data, &memoryUpdatesCompressedSize, file);
+    if (!memoryUpdatesOffset)
+      return false;
+
+    FileFrameInfoV6 dstFrame{};
+    dstFrame.fifoDataCompressedSize = static_cast<u32>(compressedFifoData->size());
     dstFrame.fifoDataSize = static_cast<u32>(srcFrame.fifoData.size());
     dstFrame.fifoDataOffset = dataOffset;
     dstFrame.fifoStart = srcFrame.fifoStart;
     dstFrame.fifoEnd = srcFrame.fifoEnd;
-    dstFrame.memoryUpdatesOffset = memoryUpdatesOffset;
+    dstFrame.memoryUpdatesOffset = *memoryUpdatesOffset;
+    dstFrame.memoryUpdatesCompressedSize = memoryUpdatesCompressedSize;
     dstFrame.numMemoryUpdates = static_cast<u32>(srcFrame.memoryUpdates.size());
 
     // Write frame info
-    u64 frameOffset = frameListOffset + (i * sizeof(FileFrameInfo));
+    u64 frameOffset = frameListOffset + (i * sizeof(FileFrameInfoV6));
     file.Seek(frameOffset, File::SeekOrigin::Begin);
-    file.WriteBytes(&dstFrame, sizeof(FileFrameInfo));
+    file.WriteBytes(&dstFrame, sizeof(FileFrameInfoV6));
   }
 
-  if (!file.Close())
+  if (!file.IsGood() || !file.Close())
     return false;
 
   return true;
@@ -316,6 +430,39 @@ std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bo
   dataFile->m_ram_size_real = header.mem1_size;
   dataFile->m_exram_size_real = header.mem2_size;
 
+  // Since version 6, only the list of frames is loaded here, and the frames themselves are read
+  // from the file when they are needed.
+  if (dataFile->m_Version >= 6)
+  {
+    std::vector<FileFrameInfoV6> srcFrames(header.frameCount);
+    file.Seek(header.frameListOffset, File::SeekOrigin::Begin);
+    if (!file.ReadArray(srcFrames.data(), srcFrames.size()))
+      return panic_failed_to_read();
+
+    dataFile->m_Frames.resize(header.frameCount);
+    dataFile->m_streamed_frames.reserve(header.frameCount);
+    for (u32 i = 0; i < header.frameCount; ++i)
+    {
+      const FileFrameInfoV6& srcFrame = srcFrames[i];
+      FifoFrameInfo& dstFrame = dataFile->m_Frames[i];
+      dstFrame.fifoStart = srcFrame.fifoStart;
+      dstFrame.fifoEnd = srcFrame.fifoEnd;
+
+      dataFile->m_streamed_frames.push_back(
+          {srcFrame.fifoDataOffset, srcFrame.fifoDataCompressedSize, srcFrame.fifoDataSize,
+           srcFrame.memoryUpdatesOffset, srcFrame.memoryUpdatesCompressedSize,
+           srcFrame.numMemoryUpdates});
+    }
+
+    dataFile->m_file = std::make_unique<File::IOFile>(std::move(file));
+    dataFile->m_frames_loading.resize(header.frameCount);
+    FifoDataFile* const data_file = dataFile.get();
+    dataFile->m_prefetch_thread.Reset("FIFO Prefetch", [data_file](u32 frame) {
+      data_file->LoadStreamedFrame(frame, false);
+    });
+    return dataFile;
+  }
+
   // Read frames
   for (u32 i = 0; i < header.frameCount; ++i)
   {
@@ -364,37 +511,6 @@ bool FifoDataFile::GetFlag(u32 flag) const
   return !!(m_Flags & flag);
 }
 
-u64 FifoDataFile::WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates,
-                                     File::IOFile& file)
-{
-  // Add space for memory update list
-  u64 updateListOffset = file.Tell();
-  PadFile(memUpdates.size() * sizeof(FileMemoryUpdate), file);
-
-  for (unsigned int i = 0; i < memUpdates.size(); ++i)
-  {
-    const MemoryUpdate& srcUpdate = memUpdates[i];
-
-    // Write memory
-    file.Seek(0, File::SeekOrigin::End);
-    u64 dataOffset = file.Tell();
-    file.WriteBytes(srcUpdate.data.data(), srcUpdate.data.size());
-
-    FileMemoryUpdate dstUpdate;
-    dstUpdate.address = srcUpdate.address;
-    dstUpdate.dataOffset = dataOffset;
-    dstUpdate.dataSize = static_cast<u32>(srcUpdate.data.size());
-    dstUpdate.fifoPosition = srcUpdate.fifoPosition;
-    dstUpdate.type = static_cast<u8>(srcUpdate.type);
-
-    u64 updateOffset = updateListOffset + (i * sizeof(FileMemoryUpdate));
-    file.Seek(updateOffset, File::SeekOrigin::Begin);
-    file.WriteBytes(&dstUpdate, sizeof(FileMemoryUpdate));
-  }
-
-  return updateListOffset;
-}
-
 void FifoDataFile::ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
                                      std::vector<MemoryUpdate>& memUpdates, File::IOFile& file)
 {
@@ -417,3 +533,123 @@ void FifoDataFile::ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
     file.ReadBytes(dstUpdate.data.data(), srcUpdate.dataSize);
   }
 }
+
+std::shared_ptr<const FifoFrameInfo> FifoDataFile::GetFrame(u32 frame)
+{
+  if (m_streamed_frames.empty())
+  {
+    // Doesn't own anything, the frames live as long as the file.
+    return std::shared_ptr<const FifoFrameInfo>(std::shared_ptr<void>(), &m_Frames[frame]);
+  }
+
+  return LoadStreamedFrame(frame, true);
+}
+
+void FifoDataFile::PrefetchFrame(u32 frame)
+{
+  if (m_streamed_frames.empty())
+    return;
+
+  {
+    std::lock_guard lk(m_frame_cache_lock);
+    if (m_frames_loading[frame] || FindCachedFrame(frame))
+      return;
+  }
+
+  m_prefetch_thread.Push(frame);
+}
+
+// m_frame_cache_lock must be held.
+std::shared_ptr<const FifoFrameInfo> FifoDataFile::FindCachedFrame(u32 frame)
+{
+  const auto iter = std::find_if(m_frame_cache.begin(), m_frame_cache.end(),
+                                 [frame](const auto& entry) { return entry.first == frame; });
+  if (iter == m_frame_cache.end())
+    return nullptr;
+
+  // Keep the most recently used frames at the back.
+  auto entry = std::move(*iter);
+  m_frame_cache.erase(iter);
+  m_frame_cache.push_back(entry);
+  return entry.second;
+}
+
+std::shared_ptr<const FifoFrameInfo> FifoDataFile::LoadStreamedFrame(u32 frame, bool wait)
+{
+  {
+    // Only one thread loads a frame at a time. The others wait for it, so that a frame which is
+    // being prefetched isn't read a second time when playback catches up with the prefetching.
+    std::unique_lock lk(m_frame_cache_lock);
+    while (true)
+    {
+      if (auto cached_frame = FindCachedFrame(frame))
+        return cached_frame;
+      if (!m_frames_loading[frame])
+        break;
+      if (!wait)
+        return nullptr;
+      m_frame_loaded.wait(lk);
+    }
+    m_frames_loading[frame] = true;
+  }
+
+  const StreamedFrame& location = m_streamed_frames[frame];
+  auto dstFrame = std::make_shared<FifoFrameInfo>();
+  dstFrame->fifoStart = m_Frames[frame].fifoStart;
+  dstFrame->fifoEnd = m_Frames[frame].fifoEnd;
+  dstFrame->fifoData.resize(location.fifo_data_size);
+  dstFrame->memoryUpdates.resize(location.num_memory_updates);
+
+  bool success;
+  {
+    std::lock_guard lk(m_file_lock);
+
+    m_file->Seek(location.fifo_data_offset, File::SeekOrigin::Begin);
+    success = ReadCompressed(*m_file, location.fifo_data_compressed_size,
+                             dstFrame->fifoData.data(), dstFrame->fifoData.size());
+
+    std::vector<FileMemoryUpdate> srcUpdates(location.num_memory_updates);
+    if (success)
+    {
+      m_file->Seek(location.memory_updates_offset, File::SeekOrigin::Begin);
+      success = ReadCompressed(*m_file, location.memory_updates_compressed_size,
+                               reinterpret_cast<u8*>(srcUpdates.data()),
+                               srcUpdates.size() * sizeof(FileMemoryUpdate));
+    }
+
+    for (u32 i = 0; success && i < location.num_memory_updates; ++i)
+    {
+      const FileMemoryUpdate& srcUpdate = srcUpdates[i];
+      MemoryUpdate& dstUpdate = dstFrame->memoryUpdates[i];
+      dstUpdate.address = srcUpdate.address;
+      dstUpdate.fifoPosition = srcUpdate.fifoPosition;
+      dstUpdate.data.resize(srcUpdate.dataSize);
+      dstUpdate.type = static_cast<MemoryUpdate::Type>(srcUpdate.type);
+
+      u32 compressed_size;
+      m_file->Seek(srcUpdate.dataOffset, File::SeekOrigin::Begin);
+      success = m_file->ReadBytes(&compressed_size, sizeof(u32)) &&
+                ReadCompressed(*m_file, compressed_size, dstUpdate.data.data(),
+                               dstUpdate.data.size());
+    }
+  }
+
+  if (!success)
+  {
+    // Callers have to check that the fifo data is as large as they expect it to be
+    ERROR_LOG_FMT(CORE, "Failed to read frame {} from the DFF file", frame);
+    dstFrame->fifoData.clear();
+    dstFrame->memoryUpdates.clear();
+  }
+
+  {
+    std::lock_guard lk(m_frame_cache_lock);
+    m_frame_cache.emplace_back(frame, dstFrame);
+    if (m_frame_cache.size() > FRAME_CACHE_SIZE)
+      m_frame_cache.pop_front();
+    m_frames_loading[frame] = false;
+  }
+  m_frame_loaded.notify_all();
+
+  return dstFrame;
+}
@@ -4,11 +4,16 @@
 #pragma once
 
 #include <array>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/WorkQueueThread.h"
 #include "VideoCommon/XFMemory.h"
 
 namespace File
@@ -73,10 +78,16 @@ public:
   u32 GetExRamSizeReal() { return m_exram_size_real; }
 
   void AddFrame(const FifoFrameInfo& frameInfo);
-  const FifoFrameInfo& GetFrame(u32 frame) const { return m_Frames[frame]; }
+  // The frames of files which are streamed from disk are loaded when they are needed, and only
+  // the most recently used ones are kept in memory. A returned frame stays valid while it is held.
+  std::shared_ptr<const FifoFrameInfo> GetFrame(u32 frame);
   u32 GetFrameCount() const { return static_cast<u32>(m_Frames.size()); }
   bool Save(const std::string& filename);
 
+  // Starts loading a frame on a background thread, so it is ready by the time GetFrame() is called
+  // for it.
+  void PrefetchFrame(u32 frame);
+
   static std::unique_ptr<FifoDataFile> Load(const std::string& filename, bool flagsOnly);
 
 private:
@@ -90,10 +101,14 @@ private:
   void SetFlag(u32 flag, bool set);
   bool GetFlag(u32 flag) const;
 
-  u64 WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
   static void ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
                                 std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
 
+  std::shared_ptr<const FifoFrameInfo> FindCachedFrame(u32 frame);
+  // Returns the cached frame, or loads it. If another thread is loading it already, this waits for
+  // it, or returns nullptr if wait is false.
+  std::shared_ptr<const FifoFrameInfo> LoadStreamedFrame(u32 frame, bool wait);
+
   std::array<u32, BP_MEM_SIZE> m_BPMem{};
   std::array<u32, CP_MEM_SIZE> m_CPMem{};
   std::array<u32, XF_MEM_SIZE> m_XFMem{};
@@ -105,5 +120,26 @@ private:
   u32 m_Flags = 0;
   u32 m_Version = 0;
 
+  // For files which are streamed, only fifoStart and fifoEnd are set.
   std::vector<FifoFrameInfo> m_Frames;
+
+  // Location of the compressed data of each frame, for files which are streamed.
+  struct StreamedFrame
+  {
+    u64 fifo_data_offset;
+    u32 fifo_data_compressed_size;
+    u32 fifo_data_size;
+    u64 memory_updates_offset;
+    u32 memory_updates_compressed_size;
+    u32 num_memory_updates;
+  };
+  std::vector<StreamedFrame> m_streamed_frames;
+  std::unique_ptr<File::IOFile> m_file;
+  std::mutex m_file_lock;
+
+  std::deque<std::pair<u32, std::shared_ptr<const FifoFrameInfo>>> m_frame_cache;
+  std::mutex m_frame_cache_lock;
+  std::vector<bool> m_frames_loading;
+  std::condition_variable m_frame_loaded;
+  Common::WorkQueueThread<u32> m_prefetch_thread;
 };
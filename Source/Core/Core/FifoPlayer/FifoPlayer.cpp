@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <memory>
 #include <mutex>
 #include <type_traits>
 
@@ -14,6 +15,7 @@
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
+#include "Core/FifoPlayer/FifoBenchmark.h"
 #include "Core/FifoPlayer/FifoDataFile.h"
 #include "Core/HW/CPU.h"
 #include "Core/HW/GPFifo.h"
@@ -82,7 +84,11 @@ void FifoPlaybackAnalyzer::AnalyzeFrames(FifoDataFile* file,
 
   for (u32 frame_no = 0; frame_no < file->GetFrameCount(); frame_no++)
   {
-    const FifoFrameInfo& frame = file->GetFrame(frame_no);
+    // Frames may be streamed from the file, so load the next one while this one is analyzed.
+    const std::shared_ptr<const FifoFrameInfo> frame_ptr = file->GetFrame(frame_no);
+    if (frame_no + 1 < file->GetFrameCount())
+      file->PrefetchFrame(frame_no + 1);
+    const FifoFrameInfo& frame = *frame_ptr;
     AnalyzedFrameInfo& analyzed = frame_info[frame_no];
 
     u32 offset = 0;
@@ -231,8 +237,19 @@ public:
     auto& system = Core::System::GetInstance();
     system.GetCPU().EnableStepping(false);
 
+    if (FifoBenchmark* benchmark = m_parent->m_benchmark)
+    {
+      const FifoBenchmark::Options& options = benchmark->GetOptions();
+      m_parent->SetFrameRangeEnd(
+          options.last_frame.value_or(m_parent->m_File->GetFrameCount() - 1));
+      m_parent->SetFrameRangeStart(options.first_frame);
+    }
+
     m_parent->m_CurrentFrame = m_parent->m_FrameRangeStart;
     m_parent->LoadMemory();
+
+    if (m_parent->m_benchmark)
+      m_parent->m_benchmark->Start(m_parent->m_FrameRangeStart, m_parent->m_FrameRangeEnd);
   }
 
   void Shutdown() override { IsPlayingBackFifologWithBrokenEFBCopies = false; }
@@ -281,7 +298,8 @@ CPU::State FifoPlayer::AdvanceFrame()
 {
   if (m_CurrentFrame > m_FrameRangeEnd)
   {
-    if (!m_Loop)
+    const bool loop = m_benchmark ? !m_benchmark->OnLoopFinished() : m_Loop;
+    if (!loop)
       return CPU::State::PowerDown;
 
     // When looping, reload the contents of all the BP/CP/CF registers.
@@ -299,7 +317,12 @@ CPU::State FifoPlayer::AdvanceFrame()
   if (m_EarlyMemoryUpdates && m_CurrentFrame == m_FrameRangeStart)
     WriteAllMemoryUpdates();
 
-  WriteFrame(m_File->GetFrame(m_CurrentFrame), m_FrameInfo[m_CurrentFrame]);
+  // Frames may be streamed from the file, so load the next one while this one is being played
+  // back.
+  const std::shared_ptr<const FifoFrameInfo> frame = m_File->GetFrame(m_CurrentFrame);
+  m_File->PrefetchFrame(m_CurrentFrame < m_FrameRangeEnd ? m_CurrentFrame + 1 : m_FrameRangeStart);
+
+  WriteFrame(*frame, m_FrameInfo[m_CurrentFrame]);
 
   ++m_CurrentFrame;
   return CPU::State::Running;
@@ -409,6 +432,10 @@ FifoPlayer& FifoPlayer::GetInstance()
 
 void FifoPlayer::WriteFrame(const FifoFrameInfo& frame, const AnalyzedFrameInfo& info)
 {
+  // A frame which failed to load from the file has no data
+  if (!info.parts.empty() && info.parts.back().m_end > frame.fifoData.size())
+    return;
+
   // Core timing information
   auto& vi = Core::System::GetInstance().GetVideoInterface();
   m_CyclesPerFrame = static_cast<u64>(SystemTimers::GetTicksPerSecond()) *
@@ -416,6 +443,9 @@ void FifoPlayer::WriteFrame(const FifoFrameInfo& frame, const AnalyzedFrameInfo&
   m_ElapsedCycles = 0;
   m_FrameFifoSize = static_cast<u32>(frame.fifoData.size());
 
+  if (m_benchmark)
+    m_benchmark->OnFrameStart();
+
   u32 memory_update = 0;
   u32 object_num = 0;
 
@@ -490,8 +520,10 @@ void FifoPlayer::WriteAllMemoryUpdates()
 
   for (u32 frameNum = 0; frameNum < m_File->GetFrameCount(); ++frameNum)
   {
-    const FifoFrameInfo& frame = m_File->GetFrame(frameNum);
-    for (auto& update : frame.memoryUpdates)
+    const std::shared_ptr<const FifoFrameInfo> frame = m_File->GetFrame(frameNum);
+    if (frameNum + 1 < m_File->GetFrameCount())
+      m_File->PrefetchFrame(frameNum + 1);
+    for (auto& update : frame->memoryUpdates)
     {
       WriteMemory(update);
     }
@@ -504,12 +536,20 @@ void FifoPlayer::WriteMemory(const MemoryUpdate& memUpdate)
   auto& memory = system.GetMemory();
   u8* mem = nullptr;
 
+  u32 address;
   if (memUpdate.address & 0x10000000)
+  {
+    address = 0x10000000 | (memUpdate.address & memory.GetExRamMask());
     mem = &memory.GetEXRAM()[memUpdate.address & memory.GetExRamMask()];
+  }
   else
+  {
+    address = memUpdate.address & memory.GetRamMask();
     mem = &memory.GetRAM()[memUpdate.address & memory.GetRamMask()];
+  }
 
   std::copy(memUpdate.data.begin(), memUpdate.data.end(), mem);
+  memory.MarkRangeWritten(address, memUpdate.data.size());
 }
 
 void FifoPlayer::WriteFifo(const u8* data, u32 start, u32 end)
@@ -557,7 +597,8 @@ void FifoPlayer::SetupFifo()
   WriteCP(CommandProcessor::CTRL_REGISTER, 0);   // disable read, BP, interrupts
   WriteCP(CommandProcessor::CLEAR_REGISTER, 7);  // clear overflow, underflow, metrics
 
-  const FifoFrameInfo& frame = m_File->GetFrame(m_CurrentFrame);
+  const std::shared_ptr<const FifoFrameInfo> frame_ptr = m_File->GetFrame(m_CurrentFrame);
+  const FifoFrameInfo& frame = *frame_ptr;
 
   // Set fifo bounds
   WriteCP(CommandProcessor::FIFO_BASE_LO, frame.fifoStart);
@@ -16,6 +16,7 @@
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/OpcodeDecoding.h"
 
+class FifoBenchmark;
 class FifoDataFile;
 struct MemoryUpdate;
 
@@ -127,6 +128,10 @@ public:
   // Callbacks
   void SetFileLoadedCallback(CallbackFunc callback);
   void SetFrameWrittenCallback(CallbackFunc callback) { m_FrameWrittenCb = std::move(callback); }
+
+  // While a benchmark is set, its frame range is played back the given number of times, and then
+  // playback stops. Must be set before emulation starts.
+  void SetBenchmark(FifoBenchmark* benchmark) { m_benchmark = benchmark; }
   static FifoPlayer& GetInstance();
 
   bool IsRunningWithFakeVideoInterfaceUpdates() const;
@@ -190,6 +195,7 @@ private:
 
   CallbackFunc m_FileLoadedCb = nullptr;
   CallbackFunc m_FrameWrittenCb = nullptr;
+  FifoBenchmark* m_benchmark = nullptr;
   Config::ConfigChangedCallbackID m_config_changed_callback_id;
 
   std::unique_ptr<FifoDataFile> m_File;
@@ -4,6 +4,7 @@
 #include "Core/HW/AddressSpace.h"
 
 #include <algorithm>
+#include <optional>
 
 #include "Common/BitUtils.h"
 #include "Core/ConfigManager.h"
@@ -351,7 +352,11 @@ private:
 struct SmallBlockAccessors : Accessors
 {
   SmallBlockAccessors() = default;
-  SmallBlockAccessors(u8** alloc_base_, u32 size_) : alloc_base{alloc_base_}, size{size_} {}
+  SmallBlockAccessors(u8** alloc_base_, u32 size_,
+                      std::optional<u32> physical_address_ = std::nullopt)
+      : alloc_base{alloc_base_}, size{size_}, physical_address{physical_address_}
+  {
+  }
 
   bool IsValidAddress(const Core::CPUThreadGuard& guard, u32 address) const override
   {
@@ -365,6 +370,8 @@ struct SmallBlockAccessors : Accessors
   void WriteU8(const Core::CPUThreadGuard& guard, u32 address, u8 value) override
   {
     (*alloc_base)[address] = value;
+    if (physical_address)
+      guard.GetSystem().GetMemory().MarkRangeWritten(*physical_address + address, 1);
   }
 
   iterator begin() const override { return *alloc_base; }
@@ -410,6 +417,8 @@ struct SmallBlockAccessors : Accessors
 private:
   u8** alloc_base = nullptr;
   u32 size = 0;
+  // Where the block lives in physical memory, if writes to it are tracked by the MemoryManager.
+  std::optional<u32> physical_address;
 };
 
 struct NullAccessors : Accessors
@@ -477,8 +486,8 @@ void Init()
   auto& system = Core::System::GetInstance();
   auto& memory = system.GetMemory();
 
-  s_mem1_address_space_accessors = {&memory.GetRAM(), memory.GetRamSizeReal()};
-  s_mem2_address_space_accessors = {&memory.GetEXRAM(), memory.GetExRamSizeReal()};
+  s_mem1_address_space_accessors = {&memory.GetRAM(), memory.GetRamSizeReal(), 0x00000000};
+  s_mem2_address_space_accessors = {&memory.GetEXRAM(), memory.GetExRamSizeReal(), 0x10000000};
   s_fake_address_space_accessors = {&memory.GetFakeVMEM(), memory.GetFakeVMemSize()};
   s_physical_address_space_accessors_gcn = {{0x00000000, &s_mem1_address_space_accessors}};
   s_physical_address_space_accessors_wii = {{0x00000000, &s_mem1_address_space_accessors},
@@ -551,6 +551,10 @@ void DSPManager::Do_ARAM_DMA()
               Common::swap64(memory.Read_U64(m_aram_dma.MMAddr));
         }
 
+        // On the Wii, "ARAM" is MEM2.
+        if (m_aram.wii_mode)
+          memory.MarkRangeWritten(0x10000000 | (m_aram_dma.ARAddr & m_aram.mask), 8);
+
         m_aram_dma.MMAddr += 8;
         m_aram_dma.ARAddr += 8;
         m_aram_dma.Cnt.count -= 8;
@@ -597,6 +601,8 @@ void DSPManager::WriteARAM(u8 value, u32 address)
 {
   // TODO: verify this on Wii
   m_aram.ptr[address & m_aram.mask] = value;
+  if (m_aram.wii_mode)
+    m_system.GetMemory().MarkRangeWritten(0x10000000 | (address & m_aram.mask), 1);
 }
 
 u8* DSPManager::GetARAMPtr() const
@@ -460,6 +460,7 @@ void AXUCode::MixAUXSamples(int aux_id, u32 write_addr, u32 read_addr)
     for (auto& buffer : buffers)
       for (u32 j = 0; j < 5 * 32; ++j)
         *ptr++ = Common::swap32(buffer[j]);
+    HLEMemory_Mark_Written(write_addr, 3 * 5 * 32 * sizeof(int));
   }
 
   // Then, we read the new temp from the CPU and add to our current
@@ -484,6 +485,7 @@ void AXUCode::UploadLRS(u32 dst_addr)
     buffers[2][i] = Common::swap32(m_samples_main_surround[i]);
   }
   memcpy(HLEMemory_Get_Pointer(dst_addr), buffers, sizeof(buffers));
+  HLEMemory_Mark_Written(dst_addr, sizeof(buffers));
 }
 
 void AXUCode::SetMainLR(u32 src_addr)
@@ -551,6 +553,7 @@ void AXUCode::OutputSamples(u32 lr_addr, u32 surround_addr)
   for (u32 i = 0; i < 5 * 32; ++i)
     surround_buffer[i] = Common::swap32(m_samples_main_surround[i]);
   memcpy(HLEMemory_Get_Pointer(surround_addr), surround_buffer, sizeof(surround_buffer));
+  HLEMemory_Mark_Written(surround_addr, sizeof(surround_buffer));
 
   // 32 samples per ms, 5 ms, 2 channels
   short buffer[5 * 32 * 2];
@@ -566,6 +569,7 @@ void AXUCode::OutputSamples(u32 lr_addr, u32 surround_addr)
   }
 
   memcpy(HLEMemory_Get_Pointer(lr_addr), buffer, sizeof(buffer));
+  HLEMemory_Mark_Written(lr_addr, sizeof(buffer));
 }
 
 void AXUCode::MixAUXBLR(u32 ul_addr, u32 dl_addr)
@@ -576,6 +580,7 @@ void AXUCode::MixAUXBLR(u32 ul_addr, u32 dl_addr)
     *ptr++ = Common::swap32(sample);
   for (auto& sample : m_samples_auxB_right)
     *ptr++ = Common::swap32(sample);
+  HLEMemory_Mark_Written(ul_addr, 2 * 5 * 32 * sizeof(int));
 
   // Mix AUXB L/R to MAIN L/R, and replace AUXB L/R
   ptr = (int*)HLEMemory_Get_Pointer(dl_addr);
@@ -622,11 +627,13 @@ void AXUCode::SendAUXAndMix(u32 auxa_lrs_up, u32 auxb_s_up, u32 main_l_dl, u32 m
     for (u32 j = 0; j < 32 * 5; ++j)
       *ptr++ = Common::swap32(up_buffer[j]);
   }
+  HLEMemory_Mark_Written(auxa_lrs_up, 3 * 32 * 5 * sizeof(int));
 
   // Upload AUXB S
   ptr = (int*)HLEMemory_Get_Pointer(auxb_s_up);
   for (auto& sample : m_samples_auxB_surround)
     *ptr++ = Common::swap32(sample);
+  HLEMemory_Mark_Written(auxb_s_up, 32 * 5 * sizeof(int));
 
   // Download buffers and addresses
   const std::array<int*, 4> dl_buffers{
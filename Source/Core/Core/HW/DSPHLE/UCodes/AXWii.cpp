@@ -505,6 +505,7 @@ void AXWiiUCode::MixAUXSamples(int aux_id, u32 write_addr, u32 read_addr, u16 vo
       for (u32 j = 0; j < 3 * 32; ++j)
         *ptr++ = Common::swap32(buffer[j]);
     }
+    HLEMemory_Mark_Written(write_addr, static_cast<u32>(buffers.size() * 3 * 32 * sizeof(int)));
   }
 
   // Then read the buffers from the CPU and add to our main buffers.
@@ -534,10 +535,12 @@ void AXWiiUCode::UploadAUXMixLRSC(int aux_id, u32* addresses, u16 volume)
     *upload_ptr++ = Common::swap32(aux_right[i]);
   for (u32 i = 0; i < 96; ++i)
     *upload_ptr++ = Common::swap32(aux_surround[i]);
+  HLEMemory_Mark_Written(addresses[0], 3 * 96 * sizeof(int));
 
   upload_ptr = (int*)HLEMemory_Get_Pointer(addresses[1]);
   for (u32 i = 0; i < 96; ++i)
     *upload_ptr++ = Common::swap32(auxc_buffer[i]);
+  HLEMemory_Mark_Written(addresses[1], 96 * sizeof(int));
 
   u16 volume_ramp[96];
   GenerateVolumeRamp(volume_ramp, m_last_aux_volumes[aux_id], volume, 96);
@@ -571,6 +574,7 @@ void AXWiiUCode::OutputSamples(u32 lr_addr, u32 surround_addr, u16 volume, bool
   for (size_t i = 0; i < upload_buffer.size(); ++i)
     upload_buffer[i] = Common::swap32(m_samples_main_surround[i]);
   memcpy(HLEMemory_Get_Pointer(surround_addr), upload_buffer.data(), sizeof(upload_buffer));
+  HLEMemory_Mark_Written(surround_addr, sizeof(upload_buffer));
 
   if (upload_auxc)
   {
@@ -578,6 +582,7 @@ void AXWiiUCode::OutputSamples(u32 lr_addr, u32 surround_addr, u16 volume, bool
     for (size_t i = 0; i < upload_buffer.size(); ++i)
       upload_buffer[i] = Common::swap32(m_samples_auxC_left[i]);
     memcpy(HLEMemory_Get_Pointer(surround_addr), upload_buffer.data(), sizeof(upload_buffer));
+    HLEMemory_Mark_Written(surround_addr, sizeof(upload_buffer));
   }
 
   // Clamp internal buffers to 16 bits.
@@ -602,6 +607,7 @@ void AXWiiUCode::OutputSamples(u32 lr_addr, u32 surround_addr, u16 volume, bool
   }
 
   memcpy(HLEMemory_Get_Pointer(lr_addr), buffer.data(), sizeof(buffer));
+  HLEMemory_Mark_Written(lr_addr, sizeof(buffer));
   m_mail_handler.PushMail(DSP_SYNC, true);
 }
 
@@ -618,6 +624,7 @@ void AXWiiUCode::OutputWMSamples(u32* addresses)
       int sample = std::clamp(in[j], -32767, 32767);
       out[j] = Common::swap16((u16)sample);
     }
+    HLEMemory_Mark_Written(addresses[i], 3 * 6 * sizeof(u16));
   }
 }
 
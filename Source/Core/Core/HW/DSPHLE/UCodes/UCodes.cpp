@@ -59,6 +59,7 @@ void HLEMemory_Write_U8(u32 address, u8 value)
     memory.GetEXRAM()[address & memory.GetExRamMask()] = value;
   else
     memory.GetRAM()[address & memory.GetRamMask()] = value;
+  HLEMemory_Mark_Written(address, sizeof(u8));
 }
 
 u16 HLEMemory_Read_U16LE(u32 address)
@@ -90,6 +91,7 @@ void HLEMemory_Write_U16LE(u32 address, u16 value)
     std::memcpy(&memory.GetEXRAM()[address & memory.GetExRamMask()], &value, sizeof(u16));
   else
     std::memcpy(&memory.GetRAM()[address & memory.GetRamMask()], &value, sizeof(u16));
+  HLEMemory_Mark_Written(address, sizeof(u16));
 }
 
 void HLEMemory_Write_U16(u32 address, u16 value)
@@ -126,6 +128,7 @@ void HLEMemory_Write_U32LE(u32 address, u32 value)
     std::memcpy(&memory.GetEXRAM()[address & memory.GetExRamMask()], &value, sizeof(u32));
   else
     std::memcpy(&memory.GetRAM()[address & memory.GetRamMask()], &value, sizeof(u32));
+  HLEMemory_Mark_Written(address, sizeof(u32));
 }
 
 void HLEMemory_Write_U32(u32 address, u32 value)
@@ -144,6 +147,17 @@ void* HLEMemory_Get_Pointer(u32 address)
   return &memory.GetRAM()[address & memory.GetRamMask()];
 }
 
+void HLEMemory_Mark_Written(u32 address, u32 size)
+{
+  auto& system = Core::System::GetInstance();
+  auto& memory = system.GetMemory();
+
+  if (ExramRead(address))
+    memory.MarkRangeWritten(0x10000000 | (address & memory.GetExRamMask()), size);
+  else
+    memory.MarkRangeWritten(address & memory.GetRamMask(), size);
+}
+
 UCodeInterface::UCodeInterface(DSPHLE* dsphle, u32 crc)
     : m_mail_handler(dsphle->AccessMailHandler()), m_dsphle(dsphle), m_crc(crc)
 {
@@ -35,6 +35,8 @@ void HLEMemory_Write_U32LE(u32 address, u32 value);
 void HLEMemory_Write_U32(u32 address, u32 value);
 
 void* HLEMemory_Get_Pointer(u32 address);
+// Has to be called after writing to memory through HLEMemory_Get_Pointer.
+void HLEMemory_Mark_Written(u32 address, u32 size);
 
 class UCodeInterface
 {
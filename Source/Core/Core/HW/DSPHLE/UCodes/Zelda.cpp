@@ -1122,6 +1122,7 @@ void ZeldaAudioRenderer::ApplyReverb(bool post_rendering)
       // Upload the reverb data to RAM.
       for (auto sample : *buffer)
         *mram_ptr++ = Common::swap16(sample);
+      HLEMemory_Mark_Written(mram_addr, static_cast<u32>(buffer->size() * sizeof(s16)));
 
       mram_buffer_idx = (mram_buffer_idx + 1) % rpb.circular_buffer_size;
       m_reverb_pb_frames_count[rpb_idx] = mram_buffer_idx;
@@ -1324,6 +1325,8 @@ void ZeldaAudioRenderer::FinalizeFrame()
     ram_left_buffer[i] = Common::swap16(m_buf_front_left[i]);
     ram_right_buffer[i] = Common::swap16(m_buf_front_right[i]);
   }
+  HLEMemory_Mark_Written(m_output_lbuf_addr, sizeof(u16) * (u32)m_buf_front_left.size());
+  HLEMemory_Mark_Written(m_output_rbuf_addr, sizeof(u16) * (u32)m_buf_front_right.size());
   m_output_lbuf_addr += sizeof(u16) * (u32)m_buf_front_left.size();
   m_output_rbuf_addr += sizeof(u16) * (u32)m_buf_front_right.size();
 
@@ -1366,6 +1369,8 @@ void ZeldaAudioRenderer::StoreVPB(u16 voice_id, VPB* vpb)
   // Only the first 0x80 words are transferred back - the rest is read-only.
   for (size_t i = 0; i < vpb_size - 0x40; ++i)
     ram_vpbs[base_idx + i] = Common::swap16(vpb_words[i]);
+  HLEMemory_Mark_Written(m_vpb_base_addr + static_cast<u32>(base_idx * sizeof(u16)),
+                         static_cast<u32>((vpb_size - 0x40) * sizeof(u16)));
 }
 
 void ZeldaAudioRenderer::LoadInputSamples(MixingBuffer* buffer, VPB* vpb)
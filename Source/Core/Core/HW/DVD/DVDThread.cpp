@@ -3,10 +3,13 @@
 
 #include "Core/HW/DVD/DVDThread.h"
 
+#include <algorithm>
+#include <cstring>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <span>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -132,6 +135,10 @@ void DVDThread::SetDisc(std::unique_ptr<DiscIO::Volume> disc)
 {
   WaitUntilIdle();
   m_disc = std::move(disc);
+
+  m_prefetch_buffer.clear();
+  m_last_read_end = std::numeric_limits<u64>::max();
+  m_last_read_was_sequential = false;
 }
 
 bool DVDThread::HasDisc() const
@@ -332,6 +339,8 @@ void DVDThread::DVDThreadMain()
 {
   Common::SetCurrentThreadName("DVD thread");
 
+  std::vector<ReadRequest> requests;
+
   while (true)
   {
     m_request_queue_expanded.Wait();
@@ -342,19 +351,147 @@ void DVDThread::DVDThreadMain()
     ReadRequest request;
     while (m_request_queue.Pop(request))
     {
-      m_file_logger.Log(*m_disc, request.partition, request.dvd_offset);
+      requests.clear();
+      requests.push_back(std::move(request));
+      while (m_request_queue.Pop(request))
+        requests.push_back(std::move(request));
+
+      // Results are still pushed in the order of the requests, and the emulated completion times
+      // were already scheduled by the CPU thread, so how requests are grouped here can't affect
+      // the emulation.
+      std::span<ReadRequest> remaining(requests);
+      while (!remaining.empty())
+      {
+        const size_t count = GetCoalescableRequestCount(remaining);
+        ProcessRequests(remaining.first(count));
+        remaining = remaining.subspan(count);
+      }
+
+      // WaitUntilIdle only waits for the request queue to be empty, so every request which was
+      // taken from it has to be finished before exiting.
+      if (m_dvd_thread_exiting.IsSet())
+        return;
+    }
 
-      std::vector<u8> buffer(request.length);
-      if (!m_disc->Read(request.dvd_offset, request.length, buffer.data(), request.partition))
-        buffer.resize(0);
+    Prefetch();
+  }
+}
 
-      request.realtime_done_us = Common::Timer::NowUs();
+size_t DVDThread::GetCoalescableRequestCount(std::span<const ReadRequest> requests) const
+{
+  const ReadRequest& first = requests.front();
+  u64 end = first.dvd_offset + first.length;
 
-      m_result_queue.Push(ReadResult(std::move(request), std::move(buffer)));
-      m_result_queue_expanded.Set();
+  size_t count = 1;
+  for (; count < requests.size(); ++count)
+  {
+    const ReadRequest& request = requests[count];
+    const u64 request_end = request.dvd_offset + request.length;
+    if (request.partition != first.partition || request.dvd_offset < first.dvd_offset ||
+        request.dvd_offset > end ||
+        std::max(end, request_end) - first.dvd_offset > MAX_COALESCED_READ_SIZE)
+    {
+      break;
+    }
 
-      if (m_dvd_thread_exiting.IsSet())
-        return;
+    end = std::max(end, request_end);
+  }
+
+  return count;
+}
+
+void DVDThread::ProcessRequests(std::span<ReadRequest> requests)
+{
+  const DiscIO::Partition& partition = requests.front().partition;
+  const u64 start = requests.front().dvd_offset;
+  u64 end = start;
+  for (const ReadRequest& request : requests)
+  {
+    m_file_logger.Log(*m_disc, request.partition, request.dvd_offset);
+    end = std::max(end, request.dvd_offset + request.length);
+  }
+
+  std::vector<u8> buffer(end - start);
+  bool success = ReadDisc(start, buffer.size(), buffer.data(), partition);
+
+  m_last_read_was_sequential = partition == m_last_read_partition && start == m_last_read_end;
+  m_last_read_partition = partition;
+  m_last_read_end = end;
+
+  for (ReadRequest& request : requests)
+  {
+    std::vector<u8> result(request.length);
+
+    // If the combined read failed, read the requests one by one so that only the requests which
+    // actually cover unreadable data fail
+    if (success)
+    {
+      std::copy_n(buffer.begin() + (request.dvd_offset - start), request.length, result.begin());
+    }
+    else if (requests.size() == 1 ||
+             !ReadDisc(request.dvd_offset, request.length, result.data(), request.partition))
+    {
+      result.resize(0);
+    }
+
+    request.realtime_done_us = Common::Timer::NowUs();
+
+    m_result_queue.Push(ReadResult(std::move(request), std::move(result)));
+    m_result_queue_expanded.Set();
+  }
+}
+
+bool DVDThread::ReadDisc(u64 offset, u64 length, u8* out_ptr, const DiscIO::Partition& partition)
+{
+  if (partition == m_prefetch_partition && offset >= m_prefetch_offset &&
+      offset < m_prefetch_offset + m_prefetch_buffer.size())
+  {
+    const u64 offset_in_buffer = offset - m_prefetch_offset;
+    const u64 prefetched_length = std::min(length, m_prefetch_buffer.size() - offset_in_buffer);
+    std::memcpy(out_ptr, m_prefetch_buffer.data() + offset_in_buffer, prefetched_length);
+
+    offset += prefetched_length;
+    length -= prefetched_length;
+    out_ptr += prefetched_length;
+    if (length == 0)
+      return true;
+  }
+
+  return m_disc->Read(offset, length, out_ptr, partition);
+}
+
+void DVDThread::Prefetch()
+{
+  if (!m_last_read_was_sequential || !m_request_queue.Empty())
+    return;
+
+  // Don't read the same data again if the previous prefetch still covers most of what's next
+  const u64 start = m_last_read_end;
+  if (m_last_read_partition == m_prefetch_partition && start >= m_prefetch_offset &&
+      m_prefetch_offset + m_prefetch_buffer.size() >= start + PREFETCH_SIZE / 2)
+  {
+    return;
+  }
+
+  m_prefetch_buffer.clear();
+  m_prefetch_buffer.reserve(PREFETCH_SIZE);
+  m_prefetch_partition = m_last_read_partition;
+  m_prefetch_offset = start;
+
+  // Read in slices and stop as soon as a request comes in, so that it only has to wait for the
+  // slice which is being read. The slices which were read until then can still be used.
+  while (m_prefetch_buffer.size() < PREFETCH_SIZE && m_request_queue.Empty() &&
+         !m_dvd_thread_exiting.IsSet())
+  {
+    const size_t size = m_prefetch_buffer.size();
+    m_prefetch_buffer.resize(size + PREFETCH_SLICE_SIZE);
+
+    // Reading past the end of the disc or partition fails, which ends the prefetch
+    if (!m_disc->Read(start + size, PREFETCH_SLICE_SIZE, m_prefetch_buffer.data() + size,
+                      m_prefetch_partition))
+    {
+      m_prefetch_buffer.resize(size);
+      break;
     }
   }
 }
@@ -3,9 +3,11 @@
 
 #pragma once
 
+#include <limits>
 #include <map>
 #include <memory>
 #include <optional>
+#include <span>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -100,6 +102,12 @@ private:
 
   void DVDThreadMain();
 
+  struct ReadRequest;
+  size_t GetCoalescableRequestCount(std::span<const ReadRequest> requests) const;
+  void ProcessRequests(std::span<ReadRequest> requests);
+  bool ReadDisc(u64 offset, u64 length, u8* out_ptr, const DiscIO::Partition& partition);
+  void Prefetch();
+
   struct ReadRequest
   {
     bool copy_to_ram = false;
@@ -141,6 +149,22 @@ private:
 
   std::unique_ptr<DiscIO::Volume> m_disc;
 
+  // Requests which are queued together and read adjacent ranges (a DMA is split into one request
+  // per ECC block) are served by a single read of the disc, up to this size.
+  static constexpr u64 MAX_COALESCED_READ_SIZE = 0x400000;
+
+  // After a read which continued where the previous read ended, the data following it is read
+  // into m_prefetch_buffer while the DVD thread is otherwise idle.
+  // These members are only used by the DVD thread.
+  static constexpr u64 PREFETCH_SIZE = 0x100000;
+  static constexpr u64 PREFETCH_SLICE_SIZE = 0x20000;
+  DiscIO::Partition m_prefetch_partition;
+  u64 m_prefetch_offset = 0;
+  std::vector<u8> m_prefetch_buffer;
+  DiscIO::Partition m_last_read_partition;
+  u64 m_last_read_end = std::numeric_limits<u64>::max();
+  bool m_last_read_was_sequential = false;
+
   FileMonitor::FileLogger m_file_logger;
 
   Core::System& m_system;
@@ -95,6 +95,7 @@ void GPFifoManager::UpdateGatherPipe()
   {
     // copy the GatherPipe
     memcpy(cur_mem, m_gather_pipe + processed, GATHER_PIPE_SIZE);
+    memory.MarkRangeWritten(processor_interface.m_fifo_cpu_write_pointer, GATHER_PIPE_SIZE);
     pipe_count -= GATHER_PIPE_SIZE;
 
     // increase the CPUWritePointer
@@ -123,6 +123,11 @@ void MemoryManager::Init()
   }
   m_arena.GrabSHMSegment(mem_size, "dolphin-emu");
 
+  m_num_ram_pages = GetRamSize() >> WRITE_TRACKING_PAGE_SHIFT;
+  m_num_exram_pages = wii ? GetExRamSize() >> WRITE_TRACKING_PAGE_SHIFT : 0;
+  m_page_write_generations =
+      std::make_unique<std::atomic<u64>[]>(m_num_ram_pages + m_num_exram_pages);
+
   m_physical_page_mappings.fill(nullptr);
 
   // Create an anonymous view of the physical memory
@@ -337,6 +342,9 @@ void MemoryManager::DoState(PointerWrap& p)
   if (current_have_exram)
     p.DoArray(m_exram, current_exram_size);
   p.DoMarker("Memory EXRAM");
+
+  if (p.IsReadMode())
+    MarkAllWritten();
 }
 
 void MemoryManager::Shutdown()
@@ -354,6 +362,9 @@ void MemoryManager::Shutdown()
   }
   m_arena.ReleaseSHMSegment();
   m_mmio_mapping.reset();
+  m_page_write_generations.reset();
+  m_num_ram_pages = 0;
+  m_num_exram_pages = 0;
   INFO_LOG_FMT(MEMMAP, "Memory system shut down.");
 }
 
@@ -397,6 +408,7 @@ void MemoryManager::Clear()
     memset(m_fake_vmem, 0, GetFakeVMemSize());
   if (m_exram)
     memset(m_exram, 0, GetExRamSize());
+  MarkAllWritten();
 }
 
 u8* MemoryManager::GetPointerForRange(u32 address, size_t size) const
@@ -445,6 +457,7 @@ void MemoryManager::CopyToEmu(u32 address, const void* data, size_t size)
     return;
   }
   memcpy(pointer, data, size);
+  MarkRangeWritten(address, size);
 }
 
 void MemoryManager::Memset(u32 address, u8 value, size_t size)
@@ -459,6 +472,69 @@ void MemoryManager::Memset(u32 address, u8 value, size_t size)
     return;
   }
   memset(pointer, value, size);
+  MarkRangeWritten(address, size);
+}
+
+std::optional<u32> MemoryManager::GetWriteTrackingPage(u32 address) const
+{
+  // Same mapping as GetPointer
+  address &= 0x3FFFFFFF;
+  if (address < GetRamSize())
+    return address >> WRITE_TRACKING_PAGE_SHIFT;
+
+  if (m_num_exram_pages != 0 && (address >> 28) == 0x1 &&
+      (address & 0x0fffffff) < GetExRamSize())
+  {
+    return m_num_ram_pages + ((address & GetExRamMask()) >> WRITE_TRACKING_PAGE_SHIFT);
+  }
+
+  return std::nullopt;
+}
+
+void MemoryManager::MarkRangeWritten(u32 address, size_t size)
+{
+  if (size == 0 || !m_page_write_generations)
+    return;
+
+  const u64 first_page = address >> WRITE_TRACKING_PAGE_SHIFT;
+  const u64 last_page = (address + size - 1) >> WRITE_TRACKING_PAGE_SHIFT;
+  for (u64 i = first_page; i <= last_page; i++)
+  {
+    if (const std::optional<u32> page =
+            GetWriteTrackingPage(static_cast<u32>(i << WRITE_TRACKING_PAGE_SHIFT)))
+    {
+      m_page_write_generations[*page].fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+}
+
+void MemoryManager::MarkAllWritten()
+{
+  if (!m_page_write_generations)
+    return;
+
+  for (u32 i = 0; i < m_num_ram_pages + m_num_exram_pages; i++)
+    m_page_write_generations[i].fetch_add(1, std::memory_order_relaxed);
+}
+
+u64 MemoryManager::GetRangeWriteGeneration(u32 address, size_t size) const
+{
+  if (size == 0 || !m_page_write_generations)
+    return 0;
+
+  // The counters only ever increase, so their sum changes whenever any of them does.
+  u64 generation = 0;
+  const u64 first_page = address >> WRITE_TRACKING_PAGE_SHIFT;
+  const u64 last_page = (address + size - 1) >> WRITE_TRACKING_PAGE_SHIFT;
+  for (u64 i = first_page; i <= last_page; i++)
+  {
+    if (const std::optional<u32> page =
+            GetWriteTrackingPage(static_cast<u32>(i << WRITE_TRACKING_PAGE_SHIFT)))
+    {
+      generation += m_page_write_generations[*page].load(std::memory_order_relaxed);
+    }
+  }
+  return generation;
 }
 
 std::string MemoryManager::GetString(u32 em_address, size_t size)
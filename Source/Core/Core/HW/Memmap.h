@@ -4,7 +4,9 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -144,6 +146,24 @@ public:
 
     for (size_t i = 0; i < size / sizeof(T); i++)
       dest[i] = Common::FromBigEndian(data[i]);
+    MarkRangeWritten(address, size);
+  }
+
+  // Tracking of writes to MEM1 and MEM2, in pages of 1 << WRITE_TRACKING_PAGE_SHIFT bytes. Writes
+  // done through the functions above and by the MMU's C++ store paths are counted automatically.
+  // Code which writes through a pointer from GetPointer has to call MarkRangeWritten itself.
+  static constexpr u32 WRITE_TRACKING_PAGE_SHIFT = 12;
+  void MarkRangeWritten(u32 address, size_t size);
+  void MarkAllWritten();
+  // Returns a value which changes whenever a tracked write touches [address, address + size).
+  u64 GetRangeWriteGeneration(u32 address, size_t size) const;
+
+  // The JITs write to guest memory directly, so the generations above only cover every write while
+  // the CPU core is an interpreter.
+  bool AreCPUWritesTracked() const { return m_cpu_writes_tracked.load(std::memory_order_relaxed); }
+  void SetCPUWritesTracked(bool tracked)
+  {
+    m_cpu_writes_tracked.store(tracked, std::memory_order_relaxed);
   }
 
 private:
@@ -187,6 +207,12 @@ private:
 
   bool m_is_fastmem_arena_initialized = false;
 
+  // One counter per page of MEM1, followed by one per page of MEM2.
+  std::unique_ptr<std::atomic<u64>[]> m_page_write_generations;
+  u32 m_num_ram_pages = 0;
+  u32 m_num_exram_pages = 0;
+  std::atomic<bool> m_cpu_writes_tracked = false;
+
   // STATE_TO_SAVE
   // Save the Init(), Shutdown() state
   bool m_is_initialized = false;
@@ -246,5 +272,7 @@ private:
   Core::System& m_system;
 
   void InitMMIO(bool is_wii);
+  // Returns the index of the write generation for the page containing address, if it's tracked.
+  std::optional<u32> GetWriteTrackingPage(u32 address) const;
 };
 }  // namespace Memory
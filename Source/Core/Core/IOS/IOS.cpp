@@ -776,12 +776,47 @@ void EmulationKernel::EnqueueIPCRequest(u32 address)
                                             address | ENQUEUE_REQUEST_FLAG);
 }
 
+// Devices write their results through raw pointers, so the output buffers of a request are
+// reported to the memory write tracking once the request is replied to.
+static void MarkReplyBuffersWritten(Core::System& system, const Request& request)
+{
+  auto& memory = system.GetMemory();
+  switch (request.command)
+  {
+  case IPC_CMD_READ:
+  {
+    const ReadWriteRequest read_request{system, request.address};
+    memory.MarkRangeWritten(read_request.buffer, read_request.size);
+    break;
+  }
+  case IPC_CMD_IOCTL:
+  {
+    const IOCtlRequest ioctl_request{system, request.address};
+    memory.MarkRangeWritten(ioctl_request.buffer_out, ioctl_request.buffer_out_size);
+    break;
+  }
+  case IPC_CMD_IOCTLV:
+  {
+    // In vectors are sometimes used as output buffers as well.
+    const IOCtlVRequest ioctlv_request{system, request.address};
+    for (const IOCtlVRequest::IOVector& vector : ioctlv_request.in_vectors)
+      memory.MarkRangeWritten(vector.address, vector.size);
+    for (const IOCtlVRequest::IOVector& vector : ioctlv_request.io_vectors)
+      memory.MarkRangeWritten(vector.address, vector.size);
+    break;
+  }
+  default:
+    break;
+  }
+}
+
 // Called to send a reply to an IOS syscall
 void EmulationKernel::EnqueueIPCReply(const Request& request, const s32 return_value,
                                       s64 cycles_in_future, CoreTiming::FromThread from)
 {
   auto& system = GetSystem();
   auto& memory = system.GetMemory();
+  MarkReplyBuffersWritten(system, request);
   memory.Write_U32(static_cast<u32>(return_value), request.address + 4);
   // IOS writes back the command that was responded to in the FD field.
   memory.Write_U32(request.command, request.address + 8);
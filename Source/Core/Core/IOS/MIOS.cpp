@@ -38,6 +38,7 @@ static void ReinitHardware()
   auto& system = Core::System::GetInstance();
   auto& memory = system.GetMemory();
   std::memset(memory.GetEXRAM(), 0, memory.GetExRamSizeReal());
+  memory.MarkAllWritten();
   // MIOS appears to only reset the DI and the PPC.
   // HACK However, resetting DI will reset the DTK config, which is set by the system menu
   // (and not by MIOS), causing games that use DTK to break.  Perhaps MIOS doesn't actually
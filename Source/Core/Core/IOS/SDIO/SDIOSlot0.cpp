@@ -287,7 +287,9 @@ s32 SDIOSlot0Device::ExecuteCommand(const Request& request, u32 buffer_in, u32 b
       if (!m_card.Seek(address, File::SeekOrigin::Begin))
         ERROR_LOG_FMT(IOS_SD, "Seek failed");
 
-      if (m_card.ReadBytes(memory.GetPointer(req.addr), size))
+      const bool read_ok = m_card.ReadBytes(memory.GetPointer(req.addr), size);
+      memory.MarkRangeWritten(req.addr, size);
+      if (read_ok)
       {
         DEBUG_LOG_FMT(IOS_SD, "Outbuffer size {} got {}", rw_buffer_size, size);
       }
@@ -402,7 +402,10 @@ void MMU::WriteToHardware(u32 em_address, const u32 data, const u32 size)
       m_ppc_state.dCache.Write(em_address, &swapped_data, size, HID0(m_ppc_state).DLOCK);
 
     if (!m_ppc_state.m_enable_dcache || wi || flag != XCheckTLBFlag::Write)
+    {
       std::memcpy(&m_memory.GetRAM()[em_address], &swapped_data, size);
+      m_memory.MarkRangeWritten(em_address, size);
+    }
 
     return;
   }
@@ -419,7 +422,10 @@ void MMU::WriteToHardware(u32 em_address, const u32 data, const u32 size)
     }
 
     if (!m_ppc_state.m_enable_dcache || wi || flag != XCheckTLBFlag::Write)
+    {
       std::memcpy(&m_memory.GetEXRAM()[em_address], &swapped_data, size);
+      m_memory.MarkRangeWritten(em_address | 0x10000000, size);
+    }
 
     return;
   }
@@ -1034,6 +1040,7 @@ void MMU::DMA_LCToMemory(const u32 mem_address, const u32 cache_address, const u
     return;
 
   memcpy(dst, src, 32 * num_blocks);
+  m_memory.MarkRangeWritten(mem_address, 32 * num_blocks);
 }
 
 void MMU::DMA_MemoryToLC(const u32 cache_address, const u32 mem_address, const u32 num_blocks)
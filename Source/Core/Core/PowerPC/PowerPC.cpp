@@ -23,6 +23,7 @@
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/HW/CPU.h"
+#include "Core/HW/Memmap.h"
 #include "Core/HW/SystemTimers.h"
 #include "Core/Host.h"
 #include "Core/PowerPC/CPUCoreBase.h"
@@ -234,6 +235,11 @@ void PowerPCManager::InitializeCPUCore(CPUCore cpu_core)
   }
 
   m_mode = m_cpu_core_base == &interpreter ? CoreMode::Interpreter : CoreMode::JIT;
+
+  // The interpreters do all stores through the MMU, but the JITs emit code which writes to guest
+  // memory directly, so the memory write tracking misses those stores.
+  m_system.GetMemory().SetCPUWritesTracked(cpu_core == CPUCore::Interpreter ||
+                                           cpu_core == CPUCore::CachedInterpreter);
 }
 
 std::span<const CPUCore> AvailableCPUCores()
@@ -15,6 +15,7 @@
 #include "Common/MsgHandler.h"
 
 #include "DiscIO/CISOBlob.h"
+#include "DiscIO/ChunkStoreBlob.h"
 #include "DiscIO/CompressedBlob.h"
 #include "DiscIO/DirectoryBlob.h"
 #include "DiscIO/FileBlob.h"
@@ -56,6 +57,8 @@ std::string GetName(BlobType blob_type, bool translate)
     return "NFS";
   case BlobType::SPLIT_PLAIN:
     return translate_str("Multi-part ISO");
+  case BlobType::CHUNK_STORE:
+    return translate_str("Chunk Store");
   default:
     return "";
   }
@@ -234,6 +237,7 @@ std::unique_ptr<BlobReader> CreateBlobReader(const std::string& filename)
   case CISO_MAGIC:
     return CISOFileReader::Create(std::move(file));
   case GCZ_MAGIC:
+  case GCZ_ZSTD_MAGIC:
     return CompressedBlobReader::Create(std::move(file), filename);
   case TGC_MAGIC:
     return TGCFileReader::Create(std::move(file));
@@ -245,6 +249,8 @@ std::unique_ptr<BlobReader> CreateBlobReader(const std::string& filename)
     return RVZFileReader::Create(std::move(file), filename);
   case NFS_MAGIC:
     return NFSFileReader::Create(std::move(file), filename);
+  case CHUNK_STORE_MAGIC:
+    return ChunkStoreFileReader::Create(std::move(file), filename);
   default:
     if (auto directory_blob = DirectoryBlobReader::Create(filename))
       return std::move(directory_blob);
@@ -25,6 +25,7 @@
 
 namespace DiscIO
 {
+enum class GCZCompressionType : u32;
 enum class WIARVZCompressionType : u32;
 
 // Increment CACHE_REVISION (GameFileCache.cpp) if the enum below is modified
@@ -42,6 +43,7 @@ enum class BlobType
   MOD_DESCRIPTOR,
   NFS,
   SPLIT_PLAIN,
+  CHUNK_STORE,
 };
 
 // If you convert an ISO file to another format and then call GetDataSize on it, what is the result?
@@ -193,14 +195,17 @@ std::unique_ptr<BlobReader> CreateBlobReader(const std::string& filename);
 
 using CompressCB = std::function<bool(const std::string& text, float percent)>;
 
+// For the compressed formats, num_threads is the number of compression threads to use.
+// 0 means one thread per CPU core.
 bool ConvertToGCZ(BlobReader* infile, const std::string& infile_path,
                   const std::string& outfile_path, u32 sub_type, int sector_size,
-                  CompressCB callback);
+                  GCZCompressionType compression_type, int compression_level, CompressCB callback,
+                  unsigned int num_threads = 0);
 bool ConvertToPlain(BlobReader* infile, const std::string& infile_path,
                     const std::string& outfile_path, CompressCB callback);
 bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
                        const std::string& outfile_path, bool rvz,
                        WIARVZCompressionType compression_type, int compression_level,
-                       int chunk_size, CompressCB callback);
+                       int chunk_size, CompressCB callback, unsigned int num_threads = 0);
 
 }  // namespace DiscIO
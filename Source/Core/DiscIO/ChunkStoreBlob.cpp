@@ -0,0 +1,453 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DiscIO/ChunkStoreBlob.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <zstd.h>
+
+#include "Common/Assert.h"
+#include "Common/CommonTypes.h"
+#include "Common/Crypto/SHA1.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "Common/MsgHandler.h"
+#include "Common/StringUtil.h"
+#include "DiscIO/Blob.h"
+#include "DiscIO/MultithreadedCompressor.h"
+
+namespace DiscIO
+{
+std::string GetChunkStorePath(const std::string& store_path, const ChunkStoreHash& hash)
+{
+  const std::string hex = Common::BytesToHexString(hash);
+  return fmt::format("{}/{}/{}", store_path, hex.substr(0, 2), hex);
+}
+
+ChunkStoreFileReader::ChunkStoreFileReader(const ChunkStoreHeader& header, u64 manifest_size,
+                                           std::string store_path,
+                                           std::vector<ChunkStoreHash> hashes)
+    : m_header(header), m_manifest_size(manifest_size), m_store_path(std::move(store_path)),
+      m_hashes(std::move(hashes))
+{
+}
+
+std::unique_ptr<ChunkStoreFileReader> ChunkStoreFileReader::Create(File::IOFile file,
+                                                                   const std::string& path)
+{
+  ChunkStoreHeader header;
+  if (!file.Seek(0, File::SeekOrigin::Begin) || !file.ReadArray(&header, 1) ||
+      header.magic != CHUNK_STORE_MAGIC)
+  {
+    return nullptr;
+  }
+
+  if (header.version != CHUNK_STORE_VERSION)
+  {
+    ERROR_LOG_FMT(DISCIO, "Chunk store manifest {} has unsupported version {}", path,
+                  header.version);
+    return nullptr;
+  }
+
+  // The data size is checked against the chunk count first so that the rounding up below can't
+  // overflow
+  if (header.chunk_size == 0 || header.chunk_size > CHUNK_STORE_MAX_CHUNK_SIZE ||
+      header.store_path_size > CHUNK_STORE_MAX_STORE_PATH_SIZE ||
+      header.data_size > u64(header.num_chunks) * header.chunk_size ||
+      header.num_chunks != (header.data_size + header.chunk_size - 1) / header.chunk_size)
+  {
+    ERROR_LOG_FMT(DISCIO, "Chunk store manifest {} is invalid", path);
+    return nullptr;
+  }
+
+  const u64 manifest_size = file.GetSize();
+  if (manifest_size < sizeof(ChunkStoreHeader) + u64(header.store_path_size) +
+                          u64(header.num_chunks) * sizeof(ChunkStoreHash))
+  {
+    ERROR_LOG_FMT(DISCIO, "Chunk store manifest {} is truncated", path);
+    return nullptr;
+  }
+
+  std::string store_path(header.store_path_size, '\0');
+  std::vector<ChunkStoreHash> hashes(header.num_chunks);
+  if (!file.ReadBytes(store_path.data(), store_path.size()) ||
+      !file.ReadArray(hashes.data(), hashes.size()))
+  {
+    ERROR_LOG_FMT(DISCIO, "Chunk store manifest {} is truncated", path);
+    return nullptr;
+  }
+
+  const std::filesystem::path store_fs_path = StringToPath(store_path);
+  if (store_fs_path.is_relative())
+    store_path = PathToString(StringToPath(path).parent_path() / store_fs_path);
+
+  return std::unique_ptr<ChunkStoreFileReader>(
+      new ChunkStoreFileReader(header, manifest_size, std::move(store_path), std::move(hashes)));
+}
+
+std::string ChunkStoreFileReader::GetCompressionMethod() const
+{
+  // i18n: Zstandard is a compression algorithm. This name should not be translated.
+  return "Zstandard";
+}
+
+bool ChunkStoreFileReader::LoadChunk(const ChunkStoreHash& hash, u32 size,
+                                     std::vector<u8>* data) const
+{
+  const std::string chunk_path = GetChunkStorePath(m_store_path, hash);
+  File::IOFile file(chunk_path, "rb");
+  if (!file)
+  {
+    ERROR_LOG_FMT(DISCIO, "Chunk {} is missing from the store", chunk_path);
+    return false;
+  }
+
+  // Compressed chunk files are always smaller than the chunk
+  const u64 file_size = file.GetSize();
+  if (file_size > size)
+  {
+    ERROR_LOG_FMT(DISCIO, "Chunk {} is too large", chunk_path);
+    return false;
+  }
+
+  data->resize(size);
+  if (file_size == size)
+  {
+    if (!file.ReadBytes(data->data(), size))
+      return false;
+  }
+  else
+  {
+    std::vector<u8> compressed(file_size);
+    if (!file.ReadBytes(compressed.data(), compressed.size()))
+      return false;
+
+    const size_t result =
+        ZSTD_decompress(data->data(), size, compressed.data(), compressed.size());
+    if (ZSTD_isError(result) || result != size)
+    {
+      ERROR_LOG_FMT(DISCIO, "Chunk {} could not be decompressed", chunk_path);
+      return false;
+    }
+  }
+
+  // The file name is the hash of the contents, which lets damaged chunks be detected
+  if (Common::SHA1::CalculateDigest(*data) != hash)
+  {
+    ERROR_LOG_FMT(DISCIO, "Chunk {} is corrupted", chunk_path);
+    return false;
+  }
+
+  return true;
+}
+
+const std::vector<u8>* ChunkStoreFileReader::GetChunk(u32 index)
+{
+  const ChunkStoreHash& hash = m_hashes[index];
+  ++m_cache_counter;
+
+  const auto iter = std::find_if(m_cache.begin(), m_cache.end(),
+                                 [&](const CachedChunk& chunk) { return chunk.hash == hash; });
+  if (iter != m_cache.end())
+  {
+    iter->last_used = m_cache_counter;
+    return &iter->data;
+  }
+
+  CachedChunk* chunk;
+  if (m_cache.size() < MAX_CACHED_CHUNKS)
+  {
+    chunk = &m_cache.emplace_back();
+  }
+  else
+  {
+    chunk = &*std::min_element(m_cache.begin(), m_cache.end(),
+                               [](const CachedChunk& a, const CachedChunk& b) {
+                                 return a.last_used < b.last_used;
+                               });
+  }
+
+  if (!LoadChunk(hash, m_header.chunk_size, &chunk->data))
+  {
+    // Make sure the failed chunk isn't mistaken for a valid one later
+    chunk->last_used = 0;
+    chunk->hash = {};
+    chunk->data.clear();
+    return nullptr;
+  }
+
+  chunk->hash = hash;
+  chunk->last_used = m_cache_counter;
+  return &chunk->data;
+}
+
+bool ChunkStoreFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
+{
+  if (offset + nbytes > m_header.data_size || offset + nbytes < offset)
+    return false;
+
+  while (nbytes > 0)
+  {
+    const u32 index = static_cast<u32>(offset / m_header.chunk_size);
+    const u64 offset_in_chunk = offset % m_header.chunk_size;
+    const u64 bytes_to_copy = std::min<u64>(nbytes, m_header.chunk_size - offset_in_chunk);
+
+    const std::vector<u8>* chunk = GetChunk(index);
+    if (!chunk)
+      return false;
+
+    std::memcpy(out_ptr, chunk->data() + offset_in_chunk, bytes_to_copy);
+
+    offset += bytes_to_copy;
+    nbytes -= bytes_to_copy;
+    out_ptr += bytes_to_copy;
+  }
+
+  return true;
+}
+
+namespace
+{
+struct CompressThreadState
+{
+  std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> context{nullptr, ZSTD_freeCCtx};
+  std::vector<u8> compressed_buffer;
+};
+
+struct CompressParameters
+{
+  std::vector<u8> data;
+  u32 chunk_index;
+  u64 inpos;
+};
+
+struct OutputParameters
+{
+  ChunkStoreHash hash;
+  // Empty if the chunk already is in the store.
+  std::vector<u8> data;
+  u32 chunk_index;
+  u64 inpos;
+};
+}  // namespace
+
+static ConversionResult<OutputParameters> Compress(CompressThreadState* state,
+                                                   CompressParameters parameters,
+                                                   const std::string& store_path,
+                                                   int compression_level)
+{
+  OutputParameters output{Common::SHA1::CalculateDigest(parameters.data), {},
+                          parameters.chunk_index, parameters.inpos};
+
+  if (File::Exists(GetChunkStorePath(store_path, output.hash)))
+    return output;
+
+  state->compressed_buffer.resize(ZSTD_compressBound(parameters.data.size()));
+  const size_t result = ZSTD_compressCCtx(
+      state->context.get(), state->compressed_buffer.data(), state->compressed_buffer.size(),
+      parameters.data.data(), parameters.data.size(), compression_level);
+  if (ZSTD_isError(result))
+    return ConversionResultCode::InternalError;
+
+  // A chunk file with the same size as the chunk is stored uncompressed, so only use the
+  // compressed data if it actually is smaller
+  if (result < parameters.data.size())
+  {
+    output.data.assign(state->compressed_buffer.begin(),
+                       state->compressed_buffer.begin() + result);
+  }
+  else
+  {
+    output.data = std::move(parameters.data);
+  }
+
+  return output;
+}
+
+static ConversionResultCode Output(OutputParameters parameters, const std::string& store_path,
+                                   const std::string& temp_suffix,
+                                   std::vector<ChunkStoreHash>* hashes, u32* new_chunks,
+                                   int progress_monitor, u32 num_chunks, CompressCB callback)
+{
+  (*hashes)[parameters.chunk_index] = parameters.hash;
+
+  // The same chunk may occur several times in one disc, so check again whether an earlier chunk
+  // has been written in the meantime
+  const std::string chunk_path = GetChunkStorePath(store_path, parameters.hash);
+  if (!parameters.data.empty() && !File::Exists(chunk_path))
+  {
+    // Write to a temporary file first, so that other readers and writers of the store never see
+    // a partially written chunk
+    const std::string temp_path = chunk_path + temp_suffix;
+    File::CreateFullPath(temp_path);
+    {
+      File::IOFile file(temp_path, "wb");
+      if (!file.WriteBytes(parameters.data.data(), parameters.data.size()))
+        return ConversionResultCode::WriteFailed;
+    }
+    if (!File::Rename(temp_path, chunk_path))
+      return ConversionResultCode::WriteFailed;
+
+    ++*new_chunks;
+  }
+
+  if (parameters.chunk_index % progress_monitor == 0)
+  {
+    const std::string text =
+        Common::FmtFormatT("{0} of {1} chunks. {2} chunks were added to the store.",
+                           parameters.chunk_index, num_chunks, *new_chunks);
+
+    const float completion = static_cast<float>(parameters.chunk_index) / num_chunks;
+
+    if (!callback(text, completion))
+      return ConversionResultCode::Canceled;
+  }
+
+  return ConversionResultCode::Success;
+}
+
+bool ConvertToChunkStore(BlobReader* infile, const std::string& infile_path,
+                         const std::string& outfile_path, const std::string& store_path,
+                         int chunk_size, int compression_level, CompressCB callback,
+                         unsigned int num_threads)
+{
+  ASSERT(infile->GetDataSizeType() == DataSizeType::Accurate);
+
+  if (!File::IsDirectory(store_path) && !File::CreateDirs(store_path))
+  {
+    PanicAlertFmtT("Failed to create the chunk store \"{0}\".", store_path);
+    return false;
+  }
+
+  File::IOFile outfile(outfile_path, "wb");
+  if (!outfile)
+  {
+    PanicAlertFmtT(
+        "Failed to open the output file \"{0}\".\n"
+        "Check that you have permissions to write the target folder and that the media can "
+        "be written.",
+        outfile_path);
+    return false;
+  }
+
+  callback(Common::GetStringT("Files opened, ready to compress."), 0);
+
+  ChunkStoreHeader header{};
+  header.magic = CHUNK_STORE_MAGIC;
+  header.version = CHUNK_STORE_VERSION;
+  header.data_size = infile->GetDataSize();
+  header.chunk_size = chunk_size;
+  header.num_chunks = static_cast<u32>((header.data_size + chunk_size - 1) / chunk_size);
+
+  // Store the path relative to the manifest if possible, so that the manifests and the store can
+  // be moved together
+  std::error_code error;
+  const std::filesystem::path absolute_store_path =
+      std::filesystem::absolute(StringToPath(store_path), error);
+  const std::filesystem::path manifest_directory =
+      std::filesystem::absolute(StringToPath(outfile_path), error).parent_path();
+  std::filesystem::path relative_store_path =
+      absolute_store_path.lexically_relative(manifest_directory);
+  const std::string manifest_store_path =
+      PathToString(relative_store_path.empty() ? absolute_store_path : relative_store_path);
+  header.store_path_size = static_cast<u32>(manifest_store_path.size());
+
+  std::vector<ChunkStoreHash> hashes(header.num_chunks);
+  u32 new_chunks = 0;
+  const int progress_monitor = std::max<int>(1, header.num_chunks / 1000);
+
+  // Unique per manifest, so that conversions running at the same time don't write to the same
+  // temporary file when they add the same chunk
+  const std::string temp_suffix =
+      fmt::format(".{:016x}.part", std::hash<std::string>{}(outfile_path));
+
+  const auto set_up_compress_thread_state = [](CompressThreadState* state) {
+    state->context.reset(ZSTD_createCCtx());
+    return state->context ? ConversionResultCode::Success : ConversionResultCode::InternalError;
+  };
+
+  const auto compress = [&](CompressThreadState* state, CompressParameters parameters) {
+    return Compress(state, std::move(parameters), store_path, compression_level);
+  };
+
+  const auto output = [&](OutputParameters parameters) {
+    return Output(std::move(parameters), store_path, temp_suffix, &hashes, &new_chunks,
+                  progress_monitor, header.num_chunks, callback);
+  };
+
+  MultithreadedCompressor<CompressThreadState, CompressParameters, OutputParameters> compressor(
+      set_up_compress_thread_state, compress, output, num_threads);
+
+  u64 inpos = 0;
+  for (u32 i = 0; i < header.num_chunks; i++)
+  {
+    if (compressor.GetStatus() != ConversionResultCode::Success)
+      break;
+
+    const u64 bytes_to_read = std::min<u64>(chunk_size, header.data_size - inpos);
+
+    // The last chunk is padded with zeroes, so that all chunks have the same size
+    std::vector<u8> in_buf(chunk_size);
+    if (!infile->Read(inpos, bytes_to_read, in_buf.data()))
+    {
+      compressor.SetError(ConversionResultCode::ReadFailed);
+      break;
+    }
+
+    inpos += bytes_to_read;
+
+    compressor.CompressAndWrite(CompressParameters{std::move(in_buf), i, inpos});
+  }
+
+  compressor.Shutdown();
+
+  ConversionResultCode result = compressor.GetStatus();
+
+  if (result == ConversionResultCode::Success)
+  {
+    if (!outfile.WriteArray(&header, 1) ||
+        !outfile.WriteBytes(manifest_store_path.data(), manifest_store_path.size()) ||
+        !outfile.WriteArray(hashes.data(), hashes.size()))
+    {
+      result = ConversionResultCode::WriteFailed;
+    }
+  }
+
+  if (result != ConversionResultCode::Success)
+  {
+    // Remove the incomplete manifest. Chunks which were added to the store are complete and may
+    // be used by other manifests, so they are kept.
+    outfile.Close();
+    File::Delete(outfile_path);
+  }
+  else
+  {
+    INFO_LOG_FMT(DISCIO, "Added {} of {} chunks of {} to the chunk store", new_chunks,
+                 header.num_chunks, infile_path);
+    callback(Common::GetStringT("Done compressing disc image."), 1.0f);
+  }
+
+  if (result == ConversionResultCode::ReadFailed)
+    PanicAlertFmtT("Failed to read from the input file \"{0}\".", infile_path);
+
+  if (result == ConversionResultCode::WriteFailed)
+  {
+    PanicAlertFmtT("Failed to write the output file \"{0}\".\n"
+                   "Check that you have enough space available on the target drive.",
+                   outfile_path);
+  }
+
+  return result == ConversionResultCode::Success;
+}
+
+}  // namespace DiscIO
@@ -0,0 +1,111 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/Crypto/SHA1.h"
+#include "Common/IOFile.h"
+#include "DiscIO/Blob.h"
+
+// A chunk store holds the data of many disc images, split into chunks of a fixed size. Each chunk
+// is stored once in a file named after the SHA-1 of its contents, so the chunks which regional
+// variants and revisions of a game have in common only take up space once. Each disc image is
+// represented by a small manifest file which lists the hashes of its chunks.
+//
+// Chunk files are stored compressed with Zstandard, except when that doesn't make them smaller,
+// in which case the file has the same size as the chunk and contains the raw data.
+//
+// Chunks are made of the data as it is stored on the disc. Wii partitions are encrypted with a key
+// which is different for each disc, so the partition data of Wii discs is rarely shared between
+// disc images, and it doesn't compress either. Unlike WIA and RVZ, this format doesn't decrypt
+// partitions first, so only GameCube discs and unencrypted Wii data benefit from it.
+
+namespace DiscIO
+{
+static constexpr u32 CHUNK_STORE_MAGIC = 0x4D534344;  // "DCSM" (byteswapped to little endian)
+static constexpr u32 CHUNK_STORE_VERSION = 1;
+
+// Limits which a manifest is checked against before anything is allocated based on it.
+static constexpr u32 CHUNK_STORE_MAX_CHUNK_SIZE = 0x4000000;
+static constexpr u32 CHUNK_STORE_MAX_STORE_PATH_SIZE = 0x10000;
+
+// Everything is stored as little endian, like in CISO.
+struct ChunkStoreHeader
+{
+  u32 magic;
+  u32 version;
+  u64 data_size;
+  u32 chunk_size;
+  u32 num_chunks;
+  // Length of the path of the store directory, which follows the header. The path is relative to
+  // the directory of the manifest unless it is absolute. The hashes of the chunks follow the path.
+  u32 store_path_size;
+  u32 unused;
+};
+static_assert(sizeof(ChunkStoreHeader) == 0x20);
+
+using ChunkStoreHash = Common::SHA1::Digest;
+
+class ChunkStoreFileReader final : public BlobReader
+{
+public:
+  static std::unique_ptr<ChunkStoreFileReader> Create(File::IOFile file,
+                                                      const std::string& path);
+
+  BlobType GetBlobType() const override { return BlobType::CHUNK_STORE; }
+
+  // Only counts the manifest, since the chunks may be shared with other disc images.
+  u64 GetRawSize() const override { return m_manifest_size; }
+  u64 GetDataSize() const override { return m_header.data_size; }
+  DataSizeType GetDataSizeType() const override { return DataSizeType::Accurate; }
+
+  u64 GetBlockSize() const override { return m_header.chunk_size; }
+  bool HasFastRandomAccessInBlock() const override { return false; }
+  std::string GetCompressionMethod() const override;
+  std::optional<int> GetCompressionLevel() const override { return std::nullopt; }
+
+  bool Read(u64 offset, u64 nbytes, u8* out_ptr) override;
+
+private:
+  struct CachedChunk
+  {
+    ChunkStoreHash hash{};
+    std::vector<u8> data;
+    u64 last_used = 0;
+  };
+
+  // A disc can contain the same chunk many times (most commonly one which is all zeroes), so the
+  // cache is keyed by hash instead of by position.
+  static constexpr size_t MAX_CACHED_CHUNKS = 4;
+
+  ChunkStoreFileReader(const ChunkStoreHeader& header, u64 manifest_size, std::string store_path,
+                       std::vector<ChunkStoreHash> hashes);
+
+  const std::vector<u8>* GetChunk(u32 index);
+  bool LoadChunk(const ChunkStoreHash& hash, u32 size, std::vector<u8>* data) const;
+
+  ChunkStoreHeader m_header;
+  u64 m_manifest_size;
+  std::string m_store_path;
+  std::vector<ChunkStoreHash> m_hashes;
+
+  std::vector<CachedChunk> m_cache;
+  u64 m_cache_counter = 0;
+};
+
+std::string GetChunkStorePath(const std::string& store_path, const ChunkStoreHash& hash);
+
+// Adds the chunks of a disc image to the store at store_path, and writes a manifest for it to
+// outfile_path. Chunks which already are in the store are not written again.
+bool ConvertToChunkStore(BlobReader* infile, const std::string& infile_path,
+                         const std::string& outfile_path, const std::string& store_path,
+                         int chunk_size, int compression_level, CompressCB callback,
+                         unsigned int num_threads = 0);
+
+}  // namespace DiscIO
@@ -4,14 +4,17 @@
 #include "DiscIO/CompressedBlob.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdio>
 #include <cstring>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
 #include <zlib.h>
+#include <zstd.h>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -25,6 +28,7 @@
 #include "Common/IOFile.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
+#include "Common/ThreadPool.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/DiscScrubber.h"
 #include "DiscIO/MultithreadedCompressor.h"
@@ -87,24 +91,106 @@ u64 CompressedBlobReader::GetBlockCompressedSize(u64 block_num) const
   return 0;
 }
 
-bool CompressedBlobReader::GetBlock(u64 block_num, u8* out_ptr)
+std::string CompressedBlobReader::GetCompressionMethod() const
+{
+  if (m_header.magic_cookie == GCZ_ZSTD_MAGIC)
+  {
+    // i18n: Zstandard is a compression algorithm. This name should not be translated.
+    return "Zstandard";
+  }
+  return "Deflate";
+}
+
+u64 CompressedBlobReader::GetBlockOffset(u64 block_num) const
+{
+  return (m_block_pointers[block_num] & ~(1ULL << 63)) + m_data_offset;
+}
+
+bool CompressedBlobReader::IsBlockCompressed(u64 block_num) const
+{
+  return (m_block_pointers[block_num] & (1ULL << 63)) == 0;
+}
+
+static Common::ThreadPool& GetDecompressionThreadPool()
+{
+  // Shared by every reader, since usually only one disc is read at a time
+  static Common::ThreadPool pool("GCZ Decompression",
+                                 std::max(std::thread::hardware_concurrency(), 2u) - 1);
+  return pool;
+}
+
+bool CompressedBlobReader::Read(u64 offset, u64 size, u8* out_ptr)
 {
-  bool uncompressed = false;
-  u32 comp_block_size = (u32)GetBlockCompressedSize(block_num);
-  u64 offset = m_block_pointers[block_num] + m_data_offset;
+  // The whole blocks in the middle of a large read skip the cache and are decompressed in
+  // parallel straight into the output. Only the partial blocks at the edges go through the cache.
+  const u64 block_size = m_header.block_size;
+  if (block_size == 0 || offset + size > GetDataSize())
+    return SectorReader::Read(offset, size, out_ptr);
+
+  const u64 first_block = (offset + block_size - 1) / block_size;
+  const u64 end_block = (offset + size) / block_size;
+  if (end_block < first_block + MIN_PARALLEL_BLOCKS)
+    return SectorReader::Read(offset, size, out_ptr);
+
+  const u64 head_size = first_block * block_size - offset;
+  const u64 middle_size = (end_block - first_block) * block_size;
+  return SectorReader::Read(offset, head_size, out_ptr) &&
+         ReadMultipleAlignedBlocks(first_block, end_block - first_block, out_ptr + head_size) &&
+         SectorReader::Read(end_block * block_size, size - head_size - middle_size,
+                            out_ptr + head_size + middle_size);
+}
 
-  if (offset & (1ULL << 63))
+bool CompressedBlobReader::ReadMultipleAlignedBlocks(u64 block_num, u64 num_blocks, u8* out_ptr)
+{
+  if (num_blocks < MIN_PARALLEL_BLOCKS)
+    return SectorReader::ReadMultipleAlignedBlocks(block_num, num_blocks, out_ptr);
+
+  // Blocks are stored in order, so the data of consecutive blocks can be read all at once
+  const u64 last_block = block_num + num_blocks - 1;
+  const u64 start = GetBlockOffset(block_num);
+  const u64 end = GetBlockOffset(last_block) + static_cast<u32>(GetBlockCompressedSize(last_block));
+  if (end < start)
+    return SectorReader::ReadMultipleAlignedBlocks(block_num, num_blocks, out_ptr);
+
+  m_multiple_blocks_buffer.resize(end - start);
+  m_file.Seek(start, File::SeekOrigin::Begin);
+  if (!m_file.ReadBytes(m_multiple_blocks_buffer.data(), m_multiple_blocks_buffer.size()))
   {
-    if (comp_block_size != m_header.block_size)
-      ERROR_LOG_FMT(DISCIO, "Uncompressed block with wrong size");
-    uncompressed = true;
-    offset &= ~(1ULL << 63);
+    ERROR_LOG_FMT(DISCIO, "The disc image \"{}\" is truncated, some of the data is missing.",
+                  m_file_name);
+    m_file.ClearError();
+    return false;
+  }
+
+  std::atomic<bool> success = true;
+  GetDecompressionThreadPool().ParallelFor(static_cast<u32>(num_blocks), [&](u32 i) {
+    const u64 block = block_num + i;
+    const u64 offset = GetBlockOffset(block) - start;
+    const u32 size = static_cast<u32>(GetBlockCompressedSize(block));
+    if (offset + size > m_multiple_blocks_buffer.size() ||
+        !DecompressBlock(block, m_multiple_blocks_buffer.data() + offset, size,
+                         out_ptr + i * m_header.block_size))
+    {
+      success = false;
+    }
+  });
+
+  return success;
+}
+
+bool CompressedBlobReader::GetBlock(u64 block_num, u8* out_ptr)
+{
+  const u32 comp_block_size = static_cast<u32>(GetBlockCompressedSize(block_num));
+  if (comp_block_size > m_zlib_buffer.size())
+  {
+    ERROR_LOG_FMT(DISCIO, "Compressed block size is larger than uncompressed block size");
+    return false;
   }
 
   // clear unused part of zlib buffer. maybe this can be deleted when it works fully.
   memset(&m_zlib_buffer[comp_block_size], 0, m_zlib_buffer.size() - comp_block_size);
 
-  m_file.Seek(offset, File::SeekOrigin::Begin);
+  m_file.Seek(GetBlockOffset(block_num), File::SeekOrigin::Begin);
   if (!m_file.ReadBytes(m_zlib_buffer.data(), comp_block_size))
   {
     ERROR_LOG_FMT(DISCIO, "The disc image \"{}\" is truncated, some of the data is missing.",
@@ -113,8 +199,14 @@ bool CompressedBlobReader::GetBlock(u64 block_num, u8* out_ptr)
     return false;
   }
 
+  return DecompressBlock(block_num, m_zlib_buffer.data(), comp_block_size, out_ptr);
+}
+
+bool CompressedBlobReader::DecompressBlock(u64 block_num, const u8* in, u32 in_size,
+                                           u8* out_ptr) const
+{
   // First, check hash.
-  const u32 block_hash = Common::HashAdler32(m_zlib_buffer.data(), comp_block_size);
+  const u32 block_hash = Common::HashAdler32(in, in_size);
   if (block_hash != m_hashes[block_num])
   {
     ERROR_LOG_FMT(DISCIO,
@@ -123,36 +215,52 @@ bool CompressedBlobReader::GetBlock(u64 block_num, u8* out_ptr)
                   m_file_name, block_num, block_hash, m_hashes[block_num]);
   }
 
-  if (uncompressed)
+  if (!IsBlockCompressed(block_num))
   {
-    std::copy(m_zlib_buffer.begin(), m_zlib_buffer.begin() + comp_block_size, out_ptr);
+    if (in_size != m_header.block_size)
+      ERROR_LOG_FMT(DISCIO, "Uncompressed block with wrong size");
+    std::copy(in, in + std::min(in_size, m_header.block_size), out_ptr);
+    return true;
   }
-  else
+
+  if (m_header.magic_cookie == GCZ_ZSTD_MAGIC)
   {
-    z_stream z = {};
-    z.next_in = m_zlib_buffer.data();
-    z.avail_in = comp_block_size;
-    if (z.avail_in > m_header.block_size)
+    // One context per thread, so that it doesn't have to be allocated for every block
+    thread_local std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> context(ZSTD_createDCtx(),
+                                                                              ZSTD_freeDCtx);
+    const size_t result =
+        ZSTD_decompressDCtx(context.get(), out_ptr, m_header.block_size, in, in_size);
+    if (ZSTD_isError(result) || result != m_header.block_size)
     {
-      ERROR_LOG_FMT(DISCIO, "Compressed block size is larger than uncompressed block size");
-    }
-    z.next_out = out_ptr;
-    z.avail_out = m_header.block_size;
-    inflateInit(&z);
-    int status = inflate(&z, Z_FULL_FLUSH);
-    u32 uncomp_size = m_header.block_size - z.avail_out;
-    if (status != Z_STREAM_END)
-    {
-      // this seem to fire wrongly from time to time
-      // to be sure, don't use compressed isos :P
-      ERROR_LOG_FMT(DISCIO, "Failure reading block {} - out of data and not at end.", block_num);
-    }
-    inflateEnd(&z);
-    if (uncomp_size != m_header.block_size)
-    {
-      ERROR_LOG_FMT(DISCIO, "Wrong block size");
+      ERROR_LOG_FMT(DISCIO, "Failure reading block {}", block_num);
       return false;
     }
+    return true;
+  }
+
+  z_stream z = {};
+  z.next_in = const_cast<u8*>(in);
+  z.avail_in = in_size;
+  if (z.avail_in > m_header.block_size)
+  {
+    ERROR_LOG_FMT(DISCIO, "Compressed block size is larger than uncompressed block size");
+  }
+  z.next_out = out_ptr;
+  z.avail_out = m_header.block_size;
+  inflateInit(&z);
+  int status = inflate(&z, Z_FULL_FLUSH);
+  u32 uncomp_size = m_header.block_size - z.avail_out;
+  if (status != Z_STREAM_END)
+  {
+    // this seem to fire wrongly from time to time
+    // to be sure, don't use compressed isos :P
+    ERROR_LOG_FMT(DISCIO, "Failure reading block {} - out of data and not at end.", block_num);
+  }
+  inflateEnd(&z);
+  if (uncomp_size != m_header.block_size)
+  {
+    ERROR_LOG_FMT(DISCIO, "Wrong block size");
+    return false;
   }
   return true;
 }
@@ -160,7 +268,11 @@ bool CompressedBlobReader::GetBlock(u64 block_num, u8* out_ptr)
 struct CompressThreadState
 {
   CompressThreadState() : z{} {}
-  ~CompressThreadState() { deflateEnd(&z); }
+  ~CompressThreadState()
+  {
+    deflateEnd(&z);
+    ZSTD_freeCCtx(zstd);
+  }
 
   // z_stream will stop working if it changes address, so this object must not be moved
   CompressThreadState(const CompressThreadState&) = delete;
@@ -170,6 +282,8 @@ struct CompressThreadState
 
   std::vector<u8> compressed_buffer;
   z_stream z;
+  // Only used for GCZ v2
+  ZSTD_CCtx* zstd = nullptr;
 };
 
 struct CompressParameters
@@ -187,10 +301,37 @@ struct OutputParameters
   u64 inpos = 0;
 };
 
-static ConversionResultCode SetUpCompressThreadState(CompressThreadState* state)
+static ConversionResultCode SetUpCompressThreadState(CompressThreadState* state,
+                                                     GCZCompressionType compression_type,
+                                                     int compression_level)
 {
-  return deflateInit(&state->z, 9) == Z_OK ? ConversionResultCode::Success :
-                                             ConversionResultCode::InternalError;
+  if (compression_type == GCZCompressionType::Zstd)
+  {
+    state->zstd = ZSTD_createCCtx();
+    if (!state->zstd || ZSTD_isError(ZSTD_CCtx_setParameter(state->zstd, ZSTD_c_compressionLevel,
+                                                            compression_level)))
+    {
+      return ConversionResultCode::InternalError;
+    }
+    return ConversionResultCode::Success;
+  }
+
+  return deflateInit(&state->z, compression_level) == Z_OK ? ConversionResultCode::Success :
+                                                             ConversionResultCode::InternalError;
+}
+
+static bool CompressZstd(CompressThreadState* state, const CompressParameters& parameters,
+                         int block_size)
+{
+  state->compressed_buffer.resize(ZSTD_compressBound(block_size));
+  const size_t result =
+      ZSTD_compress2(state->zstd, state->compressed_buffer.data(), state->compressed_buffer.size(),
+                     parameters.data.data(), block_size);
+  if (ZSTD_isError(result))
+    return false;
+
+  state->compressed_buffer.resize(result);
+  return true;
 }
 
 static ConversionResult<OutputParameters> Compress(CompressThreadState* state,
@@ -198,26 +339,42 @@ static ConversionResult<OutputParameters> Compress(CompressThreadState* state,
                                                    std::vector<u32>* hashes, int* num_stored,
                                                    int* num_compressed)
 {
-  state->compressed_buffer.resize(block_size);
-
-  int retval = deflateReset(&state->z);
-  state->z.next_in = parameters.data.data();
-  state->z.avail_in = block_size;
-  state->z.next_out = state->compressed_buffer.data();
-  state->z.avail_out = block_size;
-
-  if (retval != Z_OK)
+  bool store_compressed;
+  if (state->zstd)
   {
-    ERROR_LOG_FMT(DISCIO, "Deflate failed");
-    return ConversionResultCode::InternalError;
+    if (!CompressZstd(state, parameters, block_size))
+    {
+      ERROR_LOG_FMT(DISCIO, "Zstandard compression failed");
+      return ConversionResultCode::InternalError;
+    }
+
+    store_compressed = state->compressed_buffer.size() + 10 <= static_cast<size_t>(block_size);
   }
+  else
+  {
+    state->compressed_buffer.resize(block_size);
+
+    int retval = deflateReset(&state->z);
+    state->z.next_in = parameters.data.data();
+    state->z.avail_in = block_size;
+    state->z.next_out = state->compressed_buffer.data();
+    state->z.avail_out = block_size;
+
+    if (retval != Z_OK)
+    {
+      ERROR_LOG_FMT(DISCIO, "Deflate failed");
+      return ConversionResultCode::InternalError;
+    }
 
-  const int status = deflate(&state->z, Z_FINISH);
+    const int status = deflate(&state->z, Z_FINISH);
 
-  state->compressed_buffer.resize(block_size - state->z.avail_out);
+    state->compressed_buffer.resize(block_size - state->z.avail_out);
+
+    store_compressed = status == Z_STREAM_END && state->z.avail_out >= 10;
+  }
 
   OutputParameters output_parameters;
-  if ((status != Z_STREAM_END) || (state->z.avail_out < 10))
+  if (!store_compressed)
   {
     // let's store uncompressed
     ++*num_stored;
@@ -271,7 +428,8 @@ static ConversionResultCode Output(OutputParameters parameters, File::IOFile* ou
 
 bool ConvertToGCZ(BlobReader* infile, const std::string& infile_path,
                   const std::string& outfile_path, u32 sub_type, int block_size,
-                  CompressCB callback)
+                  GCZCompressionType compression_type, int compression_level, CompressCB callback,
+                  unsigned int num_threads)
 {
   ASSERT(infile->GetDataSizeType() == DataSizeType::Accurate);
 
@@ -289,7 +447,8 @@ bool ConvertToGCZ(BlobReader* infile, const std::string& infile_path,
   callback(Common::GetStringT("Files opened, ready to compress."), 0);
 
   CompressedBlobHeader header;
-  header.magic_cookie = GCZ_MAGIC;
+  header.magic_cookie =
+      compression_type == GCZCompressionType::Zstd ? GCZ_ZSTD_MAGIC : GCZ_MAGIC;
   header.sub_type = sub_type;
   header.block_size = block_size;
   header.data_size = infile->GetDataSize();
@@ -312,6 +471,10 @@ bool ConvertToGCZ(BlobReader* infile, const std::string& infile_path,
   int num_stored = 0;
   int progress_monitor = std::max<int>(1, header.num_blocks / 1000);
 
+  const auto set_up_compress_thread_state = [&](CompressThreadState* state) {
+    return SetUpCompressThreadState(state, compression_type, compression_level);
+  };
+
   const auto compress = [&](CompressThreadState* state, CompressParameters parameters) {
     return Compress(state, std::move(parameters), block_size, &hashes, &num_stored,
                     &num_compressed);
@@ -323,7 +486,7 @@ bool ConvertToGCZ(BlobReader* infile, const std::string& infile_path,
   };
 
   MultithreadedCompressor<CompressThreadState, CompressParameters, OutputParameters> compressor(
-      SetUpCompressThreadState, compress, output);
+      set_up_compress_thread_state, compress, output, num_threads);
 
   std::vector<u8> in_buf(block_size);
   for (u32 i = 0; i < header.num_blocks; i++)
@@ -388,7 +551,8 @@ bool IsGCZBlob(File::IOFile& file)
   if (!file.Seek(0, File::SeekOrigin::Begin))
     return false;
   CompressedBlobHeader header;
-  bool is_gcz = file.ReadArray(&header, 1) && header.magic_cookie == GCZ_MAGIC;
+  bool is_gcz = file.ReadArray(&header, 1) &&
+                (header.magic_cookie == GCZ_MAGIC || header.magic_cookie == GCZ_ZSTD_MAGIC);
   file.Seek(position, File::SeekOrigin::Begin);
   return is_gcz;
 }
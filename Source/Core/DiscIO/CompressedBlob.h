@@ -23,6 +23,18 @@
 namespace DiscIO
 {
 static constexpr u32 GCZ_MAGIC = 0xB10BC001;
+// GCZ v2 has the same structure as GCZ, but blocks are compressed with Zstandard instead of
+// Deflate, which is much faster to decompress.
+static constexpr u32 GCZ_ZSTD_MAGIC = 0xB10BC002;
+
+// Deflate level used by GCZ files created before the level was configurable.
+static constexpr int GCZ_DEFLATE_LEVEL = 9;
+
+enum class GCZCompressionType : u32
+{
+  Deflate,
+  Zstd,
+};
 
 // GCZ file structure:
 // BlobHeader
@@ -57,15 +69,28 @@ public:
 
   u64 GetBlockSize() const override { return m_header.block_size; }
   bool HasFastRandomAccessInBlock() const override { return false; }
-  std::string GetCompressionMethod() const override { return "Deflate"; }
+  std::string GetCompressionMethod() const override;
   std::optional<int> GetCompressionLevel() const override { return std::nullopt; }
 
+  bool Read(u64 offset, u64 size, u8* out_ptr) override;
+
   u64 GetBlockCompressedSize(u64 block_num) const;
   bool GetBlock(u64 block_num, u8* out_ptr) override;
 
+protected:
+  bool ReadMultipleAlignedBlocks(u64 block_num, u64 num_blocks, u8* out_ptr) override;
+
 private:
+  // Reads which cover at least this many whole blocks decompress them in parallel.
+  static constexpr u64 MIN_PARALLEL_BLOCKS = 2;
+
   CompressedBlobReader(File::IOFile file, const std::string& filename);
 
+  u64 GetBlockOffset(u64 block_num) const;
+  bool IsBlockCompressed(u64 block_num) const;
+  // Thread-safe.
+  bool DecompressBlock(u64 block_num, const u8* in, u32 in_size, u8* out_ptr) const;
+
   CompressedBlobHeader m_header;
   std::vector<u64> m_block_pointers;
   std::vector<u32> m_hashes;
@@ -73,6 +98,7 @@ private:
   File::IOFile m_file;
   u64 m_file_size;
   std::vector<u8> m_zlib_buffer;
+  std::vector<u8> m_multiple_blocks_buffer;
   std::string m_file_name;
 };
 
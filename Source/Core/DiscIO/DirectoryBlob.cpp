@@ -9,7 +9,6 @@
 #include <locale>
 #include <map>
 #include <memory>
-#include <set>
 #include <string>
 #include <utility>
 #include <variant>
@@ -63,10 +62,6 @@ DiscContent::DiscContent(u64 offset, u64 size, ContentSource source)
 {
 }
 
-DiscContent::DiscContent(u64 offset) : m_offset(offset)
-{
-}
-
 u64 DiscContent::GetOffset() const
 {
   return m_offset;
@@ -156,8 +151,24 @@ bool DiscContent::Read(u64* offset, u64* length, u8** buffer) const
 
 void DiscContentContainer::Add(u64 offset, u64 size, ContentSource source)
 {
-  if (size != 0)
-    m_contents.emplace(offset, size, std::move(source));
+  if (size == 0)
+    return;
+
+  const u64 end_offset = offset + size;
+  auto it = m_contents.end();
+  if (!m_contents.empty() && m_contents.back().GetEndOffset() >= end_offset)
+  {
+    it = std::lower_bound(m_contents.begin(), m_contents.end(), end_offset,
+                          [](const DiscContent& content, u64 end) {
+                            return content.GetEndOffset() < end;
+                          });
+  }
+
+  // Like with a set, contents that end at the same offset as an existing one are ignored
+  if (it != m_contents.end() && it->GetEndOffset() == end_offset)
+    return;
+
+  m_contents.emplace(it, offset, size, std::move(source));
 }
 
 u64 DiscContentContainer::CheckSizeAndAdd(u64 offset, const std::string& path)
@@ -177,7 +188,9 @@ u64 DiscContentContainer::CheckSizeAndAdd(u64 offset, u64 max_size, const std::s
 bool DiscContentContainer::Read(u64 offset, u64 length, u8* buffer) const
 {
   // Determine which DiscContent the offset refers to
-  std::set<DiscContent>::const_iterator it = m_contents.upper_bound(DiscContent(offset));
+  auto it = std::upper_bound(
+      m_contents.begin(), m_contents.end(), offset,
+      [](u64 value, const DiscContent& content) { return value < content.GetEndOffset(); });
 
   while (it != m_contents.end() && length > 0)
   {
@@ -1186,20 +1199,29 @@ void DirectoryBlobPartition::WriteDirectory(std::vector<FSTBuilderNode>* parent_
                                             u32* fst_offset, u32* name_offset, u64* data_offset,
                                             u32 parent_entry_index, u64 name_table_offset)
 {
-  std::vector<FSTBuilderNode>& sorted_entries = *parent_entries;
-
-  // Sort for determinism
-  std::sort(sorted_entries.begin(), sorted_entries.end(),
-            [](const FSTBuilderNode& one, const FSTBuilderNode& two) {
-              std::string one_upper = one.m_filename;
-              std::string two_upper = two.m_filename;
-              Common::ToUpper(&one_upper);
-              Common::ToUpper(&two_upper);
-              return one_upper == two_upper ? one.m_filename < two.m_filename :
-                                              one_upper < two_upper;
-            });
-
-  for (FSTBuilderNode& entry : sorted_entries)
+  // Sort for determinism. The names are converted to uppercase once up front rather than in every
+  // comparison, which matters for directories with many files.
+  std::vector<std::pair<std::string, size_t>> sort_keys;
+  sort_keys.reserve(parent_entries->size());
+  for (size_t i = 0; i < parent_entries->size(); ++i)
+  {
+    std::string upper = (*parent_entries)[i].m_filename;
+    Common::ToUpper(&upper);
+    sort_keys.emplace_back(std::move(upper), i);
+  }
+  std::sort(sort_keys.begin(), sort_keys.end(), [&](const auto& one, const auto& two) {
+    return one.first == two.first ?
+               (*parent_entries)[one.second].m_filename < (*parent_entries)[two.second].m_filename :
+               one.first < two.first;
+  });
+
+  std::vector<FSTBuilderNode> sorted_entries;
+  sorted_entries.reserve(parent_entries->size());
+  for (const auto& key : sort_keys)
+    sorted_entries.push_back(std::move((*parent_entries)[key.second]));
+  *parent_entries = std::move(sorted_entries);
+
+  for (FSTBuilderNode& entry : *parent_entries)
   {
     if (entry.IsFolder())
     {
@@ -9,7 +9,6 @@
 #include <map>
 #include <memory>
 #include <optional>
-#include <set>
 #include <string>
 #include <variant>
 #include <vector>
@@ -141,9 +140,6 @@ class DiscContent
 public:
   DiscContent(u64 offset, u64 size, ContentSource source);
 
-  // Provided because it's convenient when searching for DiscContent in an std::set
-  explicit DiscContent(u64 offset);
-
   u64 GetOffset() const;
   u64 GetEndOffset() const;
   u64 GetSize() const;
@@ -182,7 +178,9 @@ public:
   bool Read(u64 offset, u64 length, u8* buffer) const;
 
 private:
-  std::set<DiscContent> m_contents;
+  // Sorted by end offset. A flat vector is cheaper to build and search than a set, and contents
+  // are almost always added in order.
+  std::vector<DiscContent> m_contents;
 };
 
 class DirectoryBlobPartition
@@ -14,6 +14,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/MathUtil.h"
 #include "DiscIO/Blob.h"
+#include "DiscIO/ChunkStoreBlob.h"
 #include "DiscIO/Filesystem.h"
 #include "DiscIO/Volume.h"
 
@@ -236,6 +237,15 @@ bool IsDiscImageBlockSizeValid(int block_size, DiscIO::BlobType format)
       return false;
     }
 
+    break;
+  case DiscIO::BlobType::CHUNK_STORE:
+    // Block size must be a power of 2, must not split Wii blocks and must be readable
+    if (block_size < PREFERRED_MIN_BLOCK_SIZE || !MathUtil::IsPow2(block_size) ||
+        block_size > static_cast<int>(CHUNK_STORE_MAX_CHUNK_SIZE))
+    {
+      return false;
+    }
+
     break;
   default:
     ASSERT(false);
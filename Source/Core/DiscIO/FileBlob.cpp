@@ -28,8 +28,23 @@ std::unique_ptr<PlainFileReader> PlainFileReader::Create(File::IOFile file)
   return nullptr;
 }
 
+bool ReadWithIOUring(std::unique_ptr<File::IOUringReader>* io_uring, File::IOFile* file,
+                     u64 offset, u64 nbytes, u8* out_ptr)
+{
+  if (nbytes < File::IOUringReader::MIN_READ_SIZE)
+    return false;
+
+  if (!*io_uring)
+    *io_uring = std::make_unique<File::IOUringReader>();
+
+  return (*io_uring)->IsSupported() && (*io_uring)->Read(*file, offset, out_ptr, nbytes);
+}
+
 bool PlainFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
 {
+  if (ReadWithIOUring(&m_io_uring, &m_file, offset, nbytes, out_ptr))
+    return true;
+
   if (m_file.Seek(offset, File::SeekOrigin::Begin) && m_file.ReadBytes(out_ptr, nbytes))
   {
     return true;
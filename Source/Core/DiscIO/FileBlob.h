@@ -9,6 +9,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
+#include "Common/IOUringReader.h"
 #include "DiscIO/Blob.h"
 
 namespace DiscIO
@@ -36,6 +37,15 @@ private:
 
   File::IOFile m_file;
   u64 m_size;
+
+  // Only created once a large read happens, since most readers never do one.
+  std::unique_ptr<File::IOUringReader> m_io_uring;
 };
 
+// Reads nbytes with io_uring if the read is large enough to benefit from it and io_uring is
+// available. Returns false without reading anything otherwise, in which case a regular read
+// should be used instead.
+bool ReadWithIOUring(std::unique_ptr<File::IOUringReader>* io_uring, File::IOFile* file,
+                     u64 offset, u64 nbytes, u8* out_ptr);
+
 }  // namespace DiscIO
@@ -45,10 +45,11 @@ public:
       std::function<ConversionResultCode(CompressThreadState*)> set_up_compress_thread_state,
       std::function<ConversionResult<OutputParameters>(CompressThreadState*, CompressParameters)>
           compress,
-      std::function<ConversionResultCode(OutputParameters)> output)
+      std::function<ConversionResultCode(OutputParameters)> output, unsigned int num_threads = 0)
       : m_set_up_compress_thread_state(std::move(set_up_compress_thread_state)),
         m_compress(std::move(compress)), m_output(std::move(output)),
-        m_threads(std::max<unsigned int>(1, std::thread::hardware_concurrency()))
+        m_threads(num_threads != 0 ? num_threads :
+                                     std::max<unsigned int>(1, std::thread::hardware_concurrency()))
   {
     m_compress_threads = std::make_unique<CompressThread[]>(m_threads);
 
@@ -14,6 +14,7 @@
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
 #include "Common/MsgHandler.h"
+#include "DiscIO/FileBlob.h"
 
 namespace DiscIO
 {
@@ -71,7 +72,8 @@ bool SplitPlainFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
       auto& f = file.file;
       const u64 seek_offset = current_offset - file.offset;
       const u64 current_read = std::min(file.size - seek_offset, rest);
-      if (!f.Seek(seek_offset, File::SeekOrigin::Begin) || !f.ReadBytes(out, current_read))
+      if (!ReadWithIOUring(&m_io_uring, &f, seek_offset, current_read, out) &&
+          (!f.Seek(seek_offset, File::SeekOrigin::Begin) || !f.ReadBytes(out, current_read)))
       {
         f.ClearError();
         return false;
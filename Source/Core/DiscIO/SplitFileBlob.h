@@ -11,6 +11,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
+#include "Common/IOUringReader.h"
 #include "DiscIO/Blob.h"
 
 namespace DiscIO
@@ -45,6 +46,8 @@ private:
 
   std::vector<SingleFile> m_files;
   u64 m_size;
+
+  std::unique_ptr<File::IOUringReader> m_io_uring;
 };
 
 }  // namespace DiscIO
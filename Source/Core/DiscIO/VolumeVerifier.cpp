@@ -10,6 +10,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <unordered_set>
 
 #include <mbedtls/md5.h>
@@ -625,6 +626,12 @@ bool VolumeVerifier::CheckPartition(const Partition& partition)
     }
 
     m_block_errors.emplace(partition, 0);
+
+    // The groups are verified on several threads, but the volume loads the key and the H3 table
+    // of a partition lazily, which isn't thread-safe. Checking a block here loads both of them
+    // (the header read above doesn't need the key with formats like WIA and RVZ).
+    if (blocks != 0)
+      (void)m_volume.CheckBlockIntegrity(0, partition);
   }
 
   if (blank_contents)
@@ -1066,57 +1073,126 @@ void VolumeVerifier::SetUpHashing()
             [](const GroupToVerify& a, const GroupToVerify& b) { return a.offset < b.offset; });
 
   if (m_hashes_to_calculate.crc32)
+  {
     m_crc32_context = Common::StartCRC32();
+    m_crc32_thread.Reset("Verifier CRC32", [this](HashChunk chunk) {
+      m_crc32_context = Common::UpdateCRC32(m_crc32_context, chunk.data->data(),
+                                            static_cast<size_t>(chunk.size));
+    });
+  }
 
   if (m_hashes_to_calculate.md5)
   {
     mbedtls_md5_init(&m_md5_context);
     mbedtls_md5_starts_ret(&m_md5_context);
+    m_md5_thread.Reset("Verifier MD5", [this](HashChunk chunk) {
+      mbedtls_md5_update_ret(&m_md5_context, chunk.data->data(), chunk.size);
+    });
   }
 
   if (m_hashes_to_calculate.sha1)
   {
     m_sha1_context = Common::SHA1::CreateContext();
+    m_sha1_thread.Reset("Verifier SHA1", [this](HashChunk chunk) {
+      m_sha1_context->Update(chunk.data->data(), chunk.size);
+    });
+  }
+
+  if (!m_groups.empty() || !m_content_offsets.empty())
+  {
+    m_verification_pool.Reset("Verifier",
+                              std::max<u32>(1, std::thread::hardware_concurrency() / 2));
   }
 }
 
-void VolumeVerifier::WaitForAsyncOperations() const
+void VolumeVerifier::WaitForAsyncOperations()
 {
-  if (m_crc32_future.valid())
-    m_crc32_future.wait();
-  if (m_md5_future.valid())
-    m_md5_future.wait();
-  if (m_sha1_future.valid())
-    m_sha1_future.wait();
-  if (m_content_future.valid())
-    m_content_future.wait();
-  if (m_group_future.valid())
-    m_group_future.wait();
+  m_crc32_thread.WaitForCompletion();
+  m_md5_thread.WaitForCompletion();
+  m_sha1_thread.WaitForCompletion();
+  m_verification_pool.WaitForCompletion();
 }
 
-bool VolumeVerifier::ReadChunkAndWaitForAsyncOperations(u64 bytes_to_read)
+std::shared_ptr<std::vector<u8>> VolumeVerifier::AllocateChunk(u64 size)
 {
-  std::vector<u8> data(bytes_to_read);
+  {
+    std::unique_lock lk(m_chunk_lock);
+    m_chunk_freed.wait(lk, [this] { return m_chunks_in_flight < MAX_CHUNKS_IN_FLIGHT; });
+    ++m_chunks_in_flight;
+  }
+
+  return std::shared_ptr<std::vector<u8>>(new std::vector<u8>(size), [this](std::vector<u8>* p) {
+    delete p;
+    {
+      std::lock_guard lk(m_chunk_lock);
+      --m_chunks_in_flight;
+    }
+    m_chunk_freed.notify_one();
+  });
+}
+
+bool VolumeVerifier::ReadChunk(u64 bytes_to_read)
+{
+  std::shared_ptr<std::vector<u8>> data = AllocateChunk(bytes_to_read);
 
   const u64 bytes_to_copy = std::min(m_excess_bytes, bytes_to_read);
   if (bytes_to_copy > 0)
-    std::memcpy(data.data(), m_data.data() + m_data.size() - m_excess_bytes, bytes_to_copy);
+    std::memcpy(data->data(), m_data->data() + m_data->size() - m_excess_bytes, bytes_to_copy);
   bytes_to_read -= bytes_to_copy;
 
   if (bytes_to_read > 0)
   {
-    if (!m_volume.Read(m_progress + bytes_to_copy, bytes_to_read, data.data() + bytes_to_copy,
+    if (!m_volume.Read(m_progress + bytes_to_copy, bytes_to_read, data->data() + bytes_to_copy,
                        PARTITION_NONE))
     {
       return false;
     }
   }
 
-  WaitForAsyncOperations();
   m_data = std::move(data);
   return true;
 }
 
+void VolumeVerifier::VerifyGroup(const GroupToVerify& group, const std::vector<u8>* data)
+{
+  u64 biggest_verified_offset = 0;
+  size_t block_errors = 0;
+  size_t unused_block_errors = 0;
+
+  u64 offset_in_group = 0;
+  for (u64 block_index = group.block_index_start; block_index < group.block_index_end;
+       ++block_index, offset_in_group += VolumeWii::BLOCK_TOTAL_SIZE)
+  {
+    const u64 block_offset = group.offset + offset_in_group;
+
+    if (data &&
+        m_volume.CheckBlockIntegrity(block_index, data->data() + offset_in_group, group.partition))
+    {
+      biggest_verified_offset = block_offset + VolumeWii::BLOCK_TOTAL_SIZE;
+    }
+    else
+    {
+      if (m_scrubber.CanBlockBeScrubbed(block_offset))
+      {
+        WARN_LOG_FMT(DISCIO, "Integrity check failed for unused block at {:#x}", block_offset);
+        unused_block_errors++;
+      }
+      else
+      {
+        WARN_LOG_FMT(DISCIO, "Integrity check failed for block at {:#x}", block_offset);
+        block_errors++;
+      }
+    }
+  }
+
+  std::lock_guard lk(m_verification_lock);
+  m_biggest_verified_offset = std::max(m_biggest_verified_offset, biggest_verified_offset);
+  if (block_errors != 0)
+    m_block_errors[group.partition] += block_errors;
+  if (unused_block_errors != 0)
+    m_unused_block_errors[group.partition] += unused_block_errors;
+}
+
 void VolumeVerifier::Process()
 {
   ASSERT(m_started);
@@ -1188,7 +1264,7 @@ void VolumeVerifier::Process()
   }
 
   const bool is_data_needed = m_calculating_any_hash || content_read || group_read;
-  const bool read_failed = is_data_needed && !ReadChunkAndWaitForAsyncOperations(bytes_to_read);
+  const bool read_failed = is_data_needed && !ReadChunk(bytes_to_read);
 
   if (read_failed)
   {
@@ -1203,34 +1279,26 @@ void VolumeVerifier::Process()
 
   if (m_calculating_any_hash)
   {
+    const HashChunk chunk{m_data, byte_increment};
     if (m_hashes_to_calculate.crc32)
-    {
-      m_crc32_future = std::async(std::launch::async, [this, byte_increment] {
-        m_crc32_context = Common::UpdateCRC32(m_crc32_context, m_data.data(),
-                                              static_cast<size_t>(byte_increment));
-      });
-    }
-
+      m_crc32_thread.Push(chunk);
     if (m_hashes_to_calculate.md5)
-    {
-      m_md5_future = std::async(std::launch::async, [this, byte_increment] {
-        mbedtls_md5_update_ret(&m_md5_context, m_data.data(), byte_increment);
-      });
-    }
-
+      m_md5_thread.Push(chunk);
     if (m_hashes_to_calculate.sha1)
-    {
-      m_sha1_future = std::async(std::launch::async, [this, byte_increment] {
-        m_sha1_context->Update(m_data.data(), byte_increment);
-      });
-    }
+      m_sha1_thread.Push(chunk);
   }
 
+  // The workers keep the chunk alive for as long as they need it, so reading can continue
+  std::shared_ptr<const std::vector<u8>> data;
+  if (!read_failed)
+    data = m_data;
+
   if (content_read)
   {
-    m_content_future = std::async(std::launch::async, [this, read_failed, content] {
-      if (read_failed || !m_volume.CheckContentIntegrity(content, m_data, m_ticket))
+    m_verification_pool.Push([this, data, content] {
+      if (!data || !m_volume.CheckContentIntegrity(content, *data, m_ticket))
       {
+        std::lock_guard lk(m_verification_lock);
         AddProblem(Severity::High, Common::FmtFormatT("Content {0:08x} is corrupt.", content.id));
       }
     });
@@ -1240,35 +1308,8 @@ void VolumeVerifier::Process()
 
   if (group_read)
   {
-    m_group_future = std::async(std::launch::async, [this, read_failed,
-                                                     group_index = m_group_index] {
-      const GroupToVerify& group = m_groups[group_index];
-      u64 offset_in_group = 0;
-      for (u64 block_index = group.block_index_start; block_index < group.block_index_end;
-           ++block_index, offset_in_group += VolumeWii::BLOCK_TOTAL_SIZE)
-      {
-        const u64 block_offset = group.offset + offset_in_group;
-
-        if (!read_failed && m_volume.CheckBlockIntegrity(
-                                block_index, m_data.data() + offset_in_group, group.partition))
-        {
-          m_biggest_verified_offset =
-              std::max(m_biggest_verified_offset, block_offset + VolumeWii::BLOCK_TOTAL_SIZE);
-        }
-        else
-        {
-          if (m_scrubber.CanBlockBeScrubbed(block_offset))
-          {
-            WARN_LOG_FMT(DISCIO, "Integrity check failed for unused block at {:#x}", block_offset);
-            m_unused_block_errors[group.partition]++;
-          }
-          else
-          {
-            WARN_LOG_FMT(DISCIO, "Integrity check failed for block at {:#x}", block_offset);
-            m_block_errors[group.partition]++;
-          }
-        }
-      }
+    m_verification_pool.Push([this, data, group_index = m_group_index] {
+      VerifyGroup(m_groups[group_index], data.get());
     });
 
     m_group_index++;
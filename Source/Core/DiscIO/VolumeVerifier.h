@@ -3,9 +3,11 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <future>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <vector>
@@ -14,6 +16,8 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/Crypto/SHA1.h"
+#include "Common/ThreadPool.h"
+#include "Common/WorkQueueThread.h"
 #include "Core/IOS/ES/Formats.h"
 #include "DiscIO/DiscScrubber.h"
 #include "DiscIO/Volume.h"
@@ -155,9 +159,17 @@ private:
   void CheckVolumeSize();
   void CheckMisc();
   void CheckSuperPaperMario();
+  struct HashChunk
+  {
+    std::shared_ptr<const std::vector<u8>> data;
+    u64 size;
+  };
+
   void SetUpHashing();
-  void WaitForAsyncOperations() const;
-  bool ReadChunkAndWaitForAsyncOperations(u64 bytes_to_read);
+  void WaitForAsyncOperations();
+  std::shared_ptr<std::vector<u8>> AllocateChunk(u64 size);
+  bool ReadChunk(u64 bytes_to_read);
+  void VerifyGroup(const GroupToVerify& group, const std::vector<u8>* data);
 
   void AddProblem(Severity severity, std::string text);
 
@@ -178,13 +190,18 @@ private:
   mbedtls_md5_context m_md5_context{};
   std::unique_ptr<Common::SHA1::Context> m_sha1_context;
 
+  // Reading runs ahead of hashing and verification by up to this many chunks. The chunks are freed
+  // once every worker is done with them.
+  static constexpr u32 MAX_CHUNKS_IN_FLIGHT = 4;
+  std::mutex m_chunk_lock;
+  std::condition_variable m_chunk_freed;
+  u32 m_chunks_in_flight = 0;
+
+  // Guards the results which are written by the verification workers
+  std::mutex m_verification_lock;
+
   u64 m_excess_bytes = 0;
-  std::vector<u8> m_data;
-  std::future<void> m_crc32_future;
-  std::future<void> m_md5_future;
-  std::future<void> m_sha1_future;
-  std::future<void> m_content_future;
-  std::future<void> m_group_future;
+  std::shared_ptr<std::vector<u8>> m_data;
 
   DiscScrubber m_scrubber;
   IOS::ES::TicketReader m_ticket;
@@ -203,6 +220,14 @@ private:
   u64 m_progress = 0;
   u64 m_max_progress = 0;
   DataSizeType m_data_size_type;
+
+  // Each hash is updated by its own thread, since the chunks have to be hashed in order.
+  // Contents and groups are independent and get verified on a pool.
+  // These are declared last so that the workers are stopped before anything they use is destroyed.
+  Common::WorkQueueThread<HashChunk> m_crc32_thread;
+  Common::WorkQueueThread<HashChunk> m_md5_thread;
+  Common::WorkQueueThread<HashChunk> m_sha1_thread;
+  Common::ThreadPool m_verification_pool;
 };
 
 }  // namespace DiscIO
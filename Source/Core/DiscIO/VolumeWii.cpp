@@ -5,9 +5,9 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstring>
-#include <future>
 #include <map>
 #include <memory>
 #include <optional>
@@ -21,8 +21,10 @@
 #include "Common/CommonTypes.h"
 #include "Common/Crypto/AES.h"
 #include "Common/Crypto/SHA1.h"
+#include "Common/Event.h"
 #include "Common/Logging/Log.h"
 #include "Common/Swap.h"
+#include "Common/ThreadPool.h"
 
 #include "DiscIO/Blob.h"
 #include "DiscIO/DiscExtractor.h"
@@ -508,75 +510,91 @@ bool VolumeWii::CheckBlockIntegrity(u64 block_index, const Partition& partition)
   return CheckBlockIntegrity(block_index, cluster.data(), partition);
 }
 
+static Common::ThreadPool& GetCryptoThreadPool()
+{
+  // Shared by every caller, so that hashing and encrypting groups doesn't start new threads
+  static Common::ThreadPool pool(
+      "Wii Crypto", std::clamp<u32>(std::thread::hardware_concurrency(), 1,
+                                    static_cast<u32>(VolumeWii::BLOCKS_PER_GROUP)));
+  return pool;
+}
+
 bool VolumeWii::HashGroup(const std::array<u8, BLOCK_DATA_SIZE> in[BLOCKS_PER_GROUP],
                           HashBlock out[BLOCKS_PER_GROUP],
                           const std::function<bool(size_t block)>& read_function)
 {
-  std::array<std::future<void>, BLOCKS_PER_GROUP> hash_futures;
+  // The workers may still be signalling completion after this function has returned
+  struct State
+  {
+    std::atomic<size_t> remaining{BLOCKS_PER_GROUP};
+    Common::Event done;
+  };
+  const auto state = std::make_shared<State>();
+  const auto finish = [](State* s, size_t blocks) {
+    if (s->remaining.fetch_sub(blocks, std::memory_order_acq_rel) == blocks)
+      s->done.Set();
+  };
+
+  Common::ThreadPool& pool = GetCryptoThreadPool();
   bool success = true;
+  size_t blocks_pushed = 0;
 
   for (size_t i = 0; i < BLOCKS_PER_GROUP; ++i)
   {
-    if (read_function && success)
-      success = read_function(i);
+    if (read_function && !read_function(i))
+    {
+      success = false;
+      break;
+    }
 
-    hash_futures[i] = std::async(std::launch::async, [&in, &out, &hash_futures, success, i]() {
+    // Hashing each block as soon as it has been read lets reading run in parallel with hashing
+    pool.Push([in, out, state, finish, i] {
       const size_t h1_base = Common::AlignDown(i, 8);
 
-      if (success)
-      {
-        // H0 hashes
-        for (size_t j = 0; j < 31; ++j)
-          out[i].h0[j] = Common::SHA1::CalculateDigest(in[i].data() + j * 0x400, 0x400);
+      // H0 hashes
+      for (size_t j = 0; j < 31; ++j)
+        out[i].h0[j] = Common::SHA1::CalculateDigest(in[i].data() + j * 0x400, 0x400);
 
-        // H0 padding
-        out[i].padding_0 = {};
+      // H0 padding
+      out[i].padding_0 = {};
 
-        // H1 hash
-        out[h1_base].h1[i - h1_base] = Common::SHA1::CalculateDigest(out[i].h0);
-      }
+      // H1 hash
+      out[h1_base].h1[i - h1_base] = Common::SHA1::CalculateDigest(out[i].h0);
 
-      if (i % 8 == 7)
-      {
-        for (size_t j = 0; j < 7; ++j)
-          hash_futures[h1_base + j].get();
+      finish(state.get(), 1);
+    });
+    ++blocks_pushed;
+  }
 
-        if (success)
-        {
-          // H1 padding
-          out[h1_base].padding_1 = {};
+  if (blocks_pushed != BLOCKS_PER_GROUP)
+    finish(state.get(), BLOCKS_PER_GROUP - blocks_pushed);
 
-          // H1 copies
-          for (size_t j = 1; j < 8; ++j)
-            out[h1_base + j].h1 = out[h1_base].h1;
+  state->done.Wait();
 
-          // H2 hash
-          out[0].h2[h1_base / 8] = Common::SHA1::CalculateDigest(out[i].h1);
-        }
+  if (!success)
+    return false;
 
-        if (i == BLOCKS_PER_GROUP - 1)
-        {
-          for (size_t j = 0; j < 7; ++j)
-            hash_futures[j * 8 + 7].get();
+  for (size_t h1_base = 0; h1_base < BLOCKS_PER_GROUP; h1_base += 8)
+  {
+    // H1 padding
+    out[h1_base].padding_1 = {};
 
-          if (success)
-          {
-            // H2 padding
-            out[0].padding_2 = {};
+    // H1 copies
+    for (size_t j = 1; j < 8; ++j)
+      out[h1_base + j].h1 = out[h1_base].h1;
 
-            // H2 copies
-            for (size_t j = 1; j < BLOCKS_PER_GROUP; ++j)
-              out[j].h2 = out[0].h2;
-          }
-        }
-      }
-    });
+    // H2 hash
+    out[0].h2[h1_base / 8] = Common::SHA1::CalculateDigest(out[h1_base].h1);
   }
 
-  // Wait for all the async tasks to finish
-  hash_futures.back().get();
+  // H2 padding
+  out[0].padding_2 = {};
 
-  return success;
+  // H2 copies
+  for (size_t j = 1; j < BLOCKS_PER_GROUP; ++j)
+    out[j].h2 = out[0].h2;
+
+  return true;
 }
 
 bool VolumeWii::EncryptGroup(
@@ -611,34 +629,17 @@ bool VolumeWii::EncryptGroup(
   if (hash_exception_callback)
     hash_exception_callback(unencrypted_hashes.data());
 
-  const unsigned int threads =
-      std::min(BLOCKS_PER_GROUP, std::max<unsigned int>(1, std::thread::hardware_concurrency()));
-
-  std::vector<std::future<void>> encryption_futures(threads);
-
   auto aes_context = Common::AES::CreateContextEncrypt(key.data());
 
-  for (size_t i = 0; i < threads; ++i)
-  {
-    encryption_futures[i] = std::async(
-        std::launch::async,
-        [&unencrypted_data, &unencrypted_hashes, &aes_context, &out](size_t start, size_t end) {
-          for (size_t j = start; j < end; ++j)
-          {
-            u8* out_ptr = out->data() + j * BLOCK_TOTAL_SIZE;
+  GetCryptoThreadPool().ParallelFor(BLOCKS_PER_GROUP, [&](u32 i) {
+    u8* out_ptr = out->data() + i * BLOCK_TOTAL_SIZE;
 
-            aes_context->CryptIvZero(reinterpret_cast<u8*>(&unencrypted_hashes[j]), out_ptr,
-                                     BLOCK_HEADER_SIZE);
-
-            aes_context->Crypt(out_ptr + 0x3D0, unencrypted_data[j].data(),
-                               out_ptr + BLOCK_HEADER_SIZE, BLOCK_DATA_SIZE);
-          }
-        },
-        i * BLOCKS_PER_GROUP / threads, (i + 1) * BLOCKS_PER_GROUP / threads);
-  }
+    aes_context->CryptIvZero(reinterpret_cast<u8*>(&unencrypted_hashes[i]), out_ptr,
+                             BLOCK_HEADER_SIZE);
 
-  for (std::future<void>& future : encryption_futures)
-    future.get();
+    aes_context->Crypt(out_ptr + 0x3D0, unencrypted_data[i].data(), out_ptr + BLOCK_HEADER_SIZE,
+                       BLOCK_DATA_SIZE);
+  });
 
   return true;
 }
@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <cstring>
 #include <limits>
 #include <map>
@@ -79,13 +80,35 @@ std::pair<int, int> GetAllowedCompressionLevels(WIARVZCompressionType compressio
 
 template <bool RVZ>
 WIARVZFileReader<RVZ>::WIARVZFileReader(File::IOFile file, const std::string& path)
-    : m_file(std::move(file)), m_encryption_cache(this)
+    : m_file(std::move(file)), m_path(path), m_encryption_cache(this)
 {
+  m_cached_chunks.reserve(MAX_CACHED_CHUNKS);
   m_valid = Initialize(path);
 }
 
 template <bool RVZ>
-WIARVZFileReader<RVZ>::~WIARVZFileReader() = default;
+WIARVZFileReader<RVZ>::~WIARVZFileReader()
+{
+  m_read_ahead_thread.Shutdown(true);
+
+  const ChunkCacheStatistics stats = GetChunkCacheStatistics();
+  if (stats.misses != 0)
+  {
+    INFO_LOG_FMT(DISCIO,
+                 "Chunk cache for {}: {} hits, {} misses ({} read ahead), {} ms decompressing",
+                 m_path, stats.hits, stats.misses, stats.read_ahead_hits,
+                 stats.decompression_time.count() / 1000);
+  }
+}
+
+template <bool RVZ>
+typename WIARVZFileReader<RVZ>::ChunkCacheStatistics
+WIARVZFileReader<RVZ>::GetChunkCacheStatistics() const
+{
+  ChunkCacheStatistics stats = m_chunk_cache_statistics;
+  stats.decompression_time = std::chrono::microseconds(m_decompression_time_us.load());
+  return stats;
+}
 
 template <bool RVZ>
 bool WIARVZFileReader<RVZ>::Initialize(const std::string& path)
@@ -501,42 +524,32 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
     if (total_group_index >= m_group_entries.size())
       return false;
 
-    const GroupEntry group = m_group_entries[total_group_index];
     const u64 group_offset_in_data = i * chunk_size;
     const u64 offset_in_group = *offset - group_offset_in_data - data_offset;
 
+    const u64 full_chunk_size = chunk_size;
     chunk_size = std::min(chunk_size, data_size - group_offset_in_data);
 
     const u64 bytes_to_read = std::min(chunk_size - offset_in_group, *size);
-    u32 group_data_size = Common::swap32(group.data_size);
-
-    WIARVZCompressionType compression_type = m_compression_type;
-    u32 rvz_packed_size = 0;
-    if constexpr (RVZ)
-    {
-      if ((group_data_size & 0x80000000) == 0)
-        compression_type = WIARVZCompressionType::None;
-
-      group_data_size &= 0x7FFFFFFF;
-
-      rvz_packed_size = Common::swap32(group.rvz_packed_size);
-    }
 
-    if (group_data_size == 0)
+    const std::optional<ChunkParameters> parameters = GetGroupChunkParameters(
+        total_group_index, chunk_size, group_offset_in_data, exception_lists);
+    if (!parameters)
     {
       std::memset(*out_ptr, 0, bytes_to_read);
     }
     else
     {
-      const u64 group_offset_in_file = static_cast<u64>(Common::swap32(group.data_offset)) << 2;
-
-      Chunk& chunk =
-          ReadCompressedData(group_offset_in_file, group_data_size, chunk_size, compression_type,
-                             exception_lists, rvz_packed_size, group_offset_in_data);
-
-      if (!chunk.Read(offset_in_group, bytes_to_read, *out_ptr))
+      Chunk& chunk = ReadCompressedData(*parameters);
+
+      const auto start_time = std::chrono::steady_clock::now();
+      const bool success = chunk.Read(offset_in_group, bytes_to_read, *out_ptr);
+      m_decompression_time_us += std::chrono::duration_cast<std::chrono::microseconds>(
+                                     std::chrono::steady_clock::now() - start_time)
+                                     .count();
+      if (!success)
       {
-        m_cached_chunk_offset = std::numeric_limits<u64>::max();  // Invalidate the cache
+        InvalidateCachedChunk(parameters->offset_in_file);
         return false;
       }
 
@@ -551,6 +564,30 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
       }
     }
 
+    if (total_group_index != m_last_group_index)
+    {
+      if (total_group_index == m_last_group_index + 1)
+      {
+        for (u64 j = i + 1; j <= i + READ_AHEAD_GROUPS && j < number_of_groups; ++j)
+        {
+          const u64 next_offset_in_data = j * full_chunk_size;
+          const std::optional<ChunkParameters> next_parameters = GetGroupChunkParameters(
+              group_index + j, std::min(full_chunk_size, data_size - next_offset_in_data),
+              next_offset_in_data, exception_lists);
+          if (next_parameters)
+            QueueReadAhead(*next_parameters);
+        }
+      }
+      else
+      {
+        // Chunks read ahead for the previous position are unlikely to be needed anymore
+        std::lock_guard lk(m_read_ahead_lock);
+        std::erase_if(m_read_ahead_chunks, [](const auto& entry) { return entry.second.done; });
+      }
+
+      m_last_group_index = total_group_index;
+    }
+
     *offset += bytes_to_read;
     *size -= bytes_to_read;
     *out_ptr += bytes_to_read;
@@ -559,6 +596,39 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
   return true;
 }
 
+template <bool RVZ>
+std::optional<typename WIARVZFileReader<RVZ>::ChunkParameters>
+WIARVZFileReader<RVZ>::GetGroupChunkParameters(u64 total_group_index, u64 chunk_size,
+                                               u64 group_offset_in_data,
+                                               u32 exception_lists) const
+{
+  if (total_group_index >= m_group_entries.size())
+    return std::nullopt;
+
+  const GroupEntry& group = m_group_entries[total_group_index];
+  u32 group_data_size = Common::swap32(group.data_size);
+
+  WIARVZCompressionType compression_type = m_compression_type;
+  u32 rvz_packed_size = 0;
+  if constexpr (RVZ)
+  {
+    if ((group_data_size & 0x80000000) == 0)
+      compression_type = WIARVZCompressionType::None;
+
+    group_data_size &= 0x7FFFFFFF;
+
+    rvz_packed_size = Common::swap32(group.rvz_packed_size);
+  }
+
+  // The group only contains zeroes
+  if (group_data_size == 0)
+    return std::nullopt;
+
+  const u64 group_offset_in_file = static_cast<u64>(Common::swap32(group.data_offset)) << 2;
+  return ChunkParameters{group_offset_in_file, group_data_size, chunk_size, compression_type,
+                         exception_lists, rvz_packed_size, group_offset_in_data};
+}
+
 template <bool RVZ>
 typename WIARVZFileReader<RVZ>::Chunk&
 WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_size,
@@ -566,11 +636,145 @@ WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_siz
                                           WIARVZCompressionType compression_type,
                                           u32 exception_lists, u32 rvz_packed_size, u64 data_offset)
 {
-  if (offset_in_file == m_cached_chunk_offset)
-    return m_cached_chunk;
+  return ReadCompressedData(ChunkParameters{offset_in_file, compressed_size, decompressed_size,
+                                            compression_type, exception_lists, rvz_packed_size,
+                                            data_offset});
+}
+
+template <bool RVZ>
+typename WIARVZFileReader<RVZ>::Chunk&
+WIARVZFileReader<RVZ>::ReadCompressedData(const ChunkParameters& parameters)
+{
+  const u64 use = ++m_chunk_use_counter;
+
+  for (CachedChunk& cached_chunk : m_cached_chunks)
+  {
+    if (cached_chunk.offset_in_file == parameters.offset_in_file)
+    {
+      ++m_chunk_cache_statistics.hits;
+      cached_chunk.last_used = use;
+      return cached_chunk.chunk;
+    }
+  }
+
+  ++m_chunk_cache_statistics.misses;
+
+  std::optional<Chunk> chunk;
+  {
+    std::unique_lock lk(m_read_ahead_lock);
+    const auto iter = m_read_ahead_chunks.find(parameters.offset_in_file);
+    if (iter != m_read_ahead_chunks.end())
+    {
+      m_read_ahead_cv.wait(lk, [&] { return iter->second.done; });
+      if (iter->second.success)
+      {
+        ++m_chunk_cache_statistics.read_ahead_hits;
+        chunk = std::move(iter->second.chunk);
+        chunk->SetFile(&m_file);
+      }
+      m_read_ahead_chunks.erase(iter);
+    }
+  }
+
+  if (!chunk)
+    chunk = CreateChunk(&m_file, parameters);
+
+  if (m_cached_chunks.size() < MAX_CACHED_CHUNKS)
+  {
+    m_cached_chunks.push_back(CachedChunk{parameters.offset_in_file, use, std::move(*chunk)});
+    return m_cached_chunks.back().chunk;
+  }
+
+  CachedChunk& least_recently_used =
+      *std::min_element(m_cached_chunks.begin(), m_cached_chunks.end(),
+                        [](const CachedChunk& a, const CachedChunk& b) {
+                          return a.last_used < b.last_used;
+                        });
+  least_recently_used = CachedChunk{parameters.offset_in_file, use, std::move(*chunk)};
+  return least_recently_used.chunk;
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::InvalidateCachedChunk(u64 offset_in_file)
+{
+  std::erase_if(m_cached_chunks, [offset_in_file](const CachedChunk& cached_chunk) {
+    return cached_chunk.offset_in_file == offset_in_file;
+  });
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::QueueReadAhead(const ChunkParameters& parameters)
+{
+  for (const CachedChunk& cached_chunk : m_cached_chunks)
+  {
+    if (cached_chunk.offset_in_file == parameters.offset_in_file)
+      return;
+  }
+
+  {
+    std::lock_guard lk(m_read_ahead_lock);
+
+    // Groups which were skipped over leave behind chunks which are never used
+    if (m_read_ahead_chunks.size() >= 2 * READ_AHEAD_GROUPS)
+      std::erase_if(m_read_ahead_chunks, [](const auto& entry) { return entry.second.done; });
+
+    if (!m_read_ahead_chunks.try_emplace(parameters.offset_in_file).second)
+      return;
+  }
+
+  // Most readers are never read sequentially (e.g. when the game list is populated), so only
+  // start the thread once it's needed
+  if (!m_read_ahead_file.IsOpen())
+  {
+    if (!m_read_ahead_file.Open(m_path, "rb"))
+    {
+      std::lock_guard lk(m_read_ahead_lock);
+      m_read_ahead_chunks.erase(parameters.offset_in_file);
+      return;
+    }
+
+    m_read_ahead_thread.Reset("WIA/RVZ Read Ahead", [this](ChunkParameters p) { ReadAhead(p); });
+  }
+
+  m_read_ahead_thread.Push(parameters);
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::ReadAhead(const ChunkParameters& parameters)
+{
+  {
+    std::lock_guard lk(m_read_ahead_lock);
+    if (!m_read_ahead_chunks.contains(parameters.offset_in_file))
+      return;
+  }
+
+  const auto start_time = std::chrono::steady_clock::now();
+  Chunk chunk = CreateChunk(&m_read_ahead_file, parameters);
+  const bool success = chunk.DecompressAll();
+  m_decompression_time_us += std::chrono::duration_cast<std::chrono::microseconds>(
+                                 std::chrono::steady_clock::now() - start_time)
+                                 .count();
+
+  std::lock_guard lk(m_read_ahead_lock);
+  const auto iter = m_read_ahead_chunks.find(parameters.offset_in_file);
+  if (iter == m_read_ahead_chunks.end())
+    return;
+
+  iter->second.chunk = std::move(chunk);
+  iter->second.success = success;
+  iter->second.done = true;
+  m_read_ahead_cv.notify_all();
+}
+
+template <bool RVZ>
+typename WIARVZFileReader<RVZ>::Chunk
+WIARVZFileReader<RVZ>::CreateChunk(File::IOFile* file, const ChunkParameters& parameters) const
+{
+  const u64 decompressed_size = parameters.decompressed_size;
+  const u32 rvz_packed_size = parameters.rvz_packed_size;
 
   std::unique_ptr<Decompressor> decompressor;
-  switch (compression_type)
+  switch (parameters.compression_type)
   {
   case WIARVZCompressionType::None:
     decompressor = std::make_unique<NoneDecompressor>();
@@ -595,13 +799,12 @@ WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_siz
     break;
   }
 
-  const bool compressed_exception_lists = compression_type > WIARVZCompressionType::Purge;
+  const bool compressed_exception_lists =
+      parameters.compression_type > WIARVZCompressionType::Purge;
 
-  m_cached_chunk =
-      Chunk(&m_file, offset_in_file, compressed_size, decompressed_size, exception_lists,
-            compressed_exception_lists, rvz_packed_size, data_offset, std::move(decompressor));
-  m_cached_chunk_offset = offset_in_file;
-  return m_cached_chunk;
+  return Chunk(file, parameters.offset_in_file, parameters.compressed_size, decompressed_size,
+               parameters.exception_lists, compressed_exception_lists, rvz_packed_size,
+               parameters.data_offset, std::move(decompressor));
 }
 
 template <bool RVZ>
@@ -645,16 +848,29 @@ WIARVZFileReader<RVZ>::Chunk::Chunk(File::IOFile* file, u64 offset_in_file, u64
 template <bool RVZ>
 bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
 {
-  if (!m_decompressor || !m_file ||
-      offset + size > m_out.data.size() - m_out_bytes_allocated_for_exceptions)
-  {
+  if (!DecompressUpTo(offset + size))
     return false;
-  }
 
-  while (offset + size > GetOutBytesWrittenExcludingExceptions())
+  std::memcpy(out_ptr, m_out.data.data() + offset + m_out_bytes_used_for_exceptions, size);
+  return true;
+}
+
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::Chunk::DecompressAll()
+{
+  return DecompressUpTo(m_out.data.size() - m_out_bytes_allocated_for_exceptions);
+}
+
+template <bool RVZ>
+bool WIARVZFileReader<RVZ>::Chunk::DecompressUpTo(u64 end)
+{
+  if (!m_decompressor || !m_file || end > m_out.data.size() - m_out_bytes_allocated_for_exceptions)
+    return false;
+
+  while (end > GetOutBytesWrittenExcludingExceptions())
   {
     u64 bytes_to_read;
-    if (offset + size == m_out.data.size())
+    if (end == m_out.data.size())
     {
       // Read all the remaining data.
       bytes_to_read = m_in.data.size() - m_in.bytes_written;
@@ -667,7 +883,7 @@ bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
 
       // The compressed data is probably not much bigger than the decompressed data.
       // Add a few bytes for possible compression overhead and for any hash exceptions.
-      bytes_to_read = offset + size - GetOutBytesWrittenExcludingExceptions() + 0x100;
+      bytes_to_read = end - GetOutBytesWrittenExcludingExceptions() + 0x100;
 
       // Align the access in an attempt to gain speed. But we don't actually know the
       // block size of the underlying storage device, so we just use the Wii block size.
@@ -747,7 +963,6 @@ bool WIARVZFileReader<RVZ>::Chunk::Read(u64 offset, u64 size, u8* out_ptr)
     }
   }
 
-  std::memcpy(out_ptr, m_out.data.data() + offset + m_out_bytes_used_for_exceptions, size);
   return true;
 }
 
@@ -1729,7 +1944,8 @@ template <bool RVZ>
 ConversionResultCode
 WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volume,
                                File::IOFile* outfile, WIARVZCompressionType compression_type,
-                               int compression_level, int chunk_size, CompressCB callback)
+                               int compression_level, int chunk_size, CompressCB callback,
+                               unsigned int num_threads)
 {
   ASSERT(infile->GetDataSizeType() == DataSizeType::Accurate);
   ASSERT(chunk_size > 0);
@@ -1836,7 +2052,7 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
   };
 
   MultithreadedCompressor<CompressThreadState, CompressParameters, OutputParameters> mt_compressor(
-      set_up_compress_thread_state, process_and_compress, output);
+      set_up_compress_thread_state, process_and_compress, output, num_threads);
 
   for (const DataEntry& data_entry : data_entries)
   {
@@ -2028,7 +2244,7 @@ WIARVZFileReader<RVZ>::Convert(BlobReader* infile, const VolumeDisc* infile_volu
 bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
                        const std::string& outfile_path, bool rvz,
                        WIARVZCompressionType compression_type, int compression_level,
-                       int chunk_size, CompressCB callback)
+                       int chunk_size, CompressCB callback, unsigned int num_threads)
 {
   File::IOFile outfile(outfile_path, "wb");
   if (!outfile)
@@ -2046,7 +2262,7 @@ bool ConvertToWIAOrRVZ(BlobReader* infile, const std::string& infile_path,
   const auto convert = rvz ? RVZFileReader::Convert : WIAFileReader::Convert;
   const ConversionResultCode result =
       convert(infile, infile_volume.get(), &outfile, compression_type, compression_level,
-              chunk_size, callback);
+              chunk_size, callback, num_threads);
 
   if (result == ConversionResultCode::ReadFailed)
     PanicAlertFmtT("Failed to read from the input file \"{0}\".", infile_path);
@@ -4,17 +4,24 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/Crypto/SHA1.h"
 #include "Common/IOFile.h"
 #include "Common/Swap.h"
+#include "Common/WorkQueueThread.h"
 #include "DiscIO/Blob.h"
 #include "DiscIO/MultithreadedCompressor.h"
 #include "DiscIO/WIACompression.h"
@@ -66,9 +73,21 @@ public:
   bool SupportsReadWiiDecrypted(u64 offset, u64 size, u64 partition_data_offset) const override;
   bool ReadWiiDecrypted(u64 offset, u64 size, u8* out_ptr, u64 partition_data_offset) override;
 
+  struct ChunkCacheStatistics
+  {
+    u64 hits = 0;
+    u64 misses = 0;
+    // Misses which were served by a chunk that had been decompressed ahead of time
+    u64 read_ahead_hits = 0;
+    // Time spent reading and decompressing chunks, both inline and on the read-ahead thread
+    std::chrono::microseconds decompression_time{};
+  };
+  ChunkCacheStatistics GetChunkCacheStatistics() const;
+
   static ConversionResultCode Convert(BlobReader* infile, const VolumeDisc* infile_volume,
                                       File::IOFile* outfile, WIARVZCompressionType compression_type,
-                                      int compression_level, int chunk_size, CompressCB callback);
+                                      int compression_level, int chunk_size, CompressCB callback,
+                                      unsigned int num_threads = 0);
 
 private:
   using WiiKey = std::array<u8, 16>;
@@ -192,6 +211,9 @@ private:
           u64 data_offset, std::unique_ptr<Decompressor> decompressor);
 
     bool Read(u64 offset, u64 size, u8* out_ptr);
+    bool DecompressAll();
+
+    void SetFile(File::IOFile* file) { m_file = file; }
 
     // This can only be called once at least one byte of data has been read
     void GetHashExceptions(std::vector<HashExceptionEntry>* exception_list,
@@ -204,6 +226,7 @@ private:
     }
 
   private:
+    bool DecompressUpTo(u64 end);
     bool Decompress();
     bool HandleExceptions(const u8* data, size_t bytes_allocated, size_t bytes_written,
                           size_t* bytes_used, bool align);
@@ -227,6 +250,31 @@ private:
     u64 m_data_offset = 0;
   };
 
+  struct ChunkParameters
+  {
+    u64 offset_in_file;
+    u64 compressed_size;
+    u64 decompressed_size;
+    WIARVZCompressionType compression_type;
+    u32 exception_lists;
+    u32 rvz_packed_size;
+    u64 data_offset;
+  };
+
+  struct CachedChunk
+  {
+    u64 offset_in_file;
+    u64 last_used;
+    Chunk chunk;
+  };
+
+  struct ReadAheadChunk
+  {
+    bool done = false;
+    bool success = false;
+    Chunk chunk;
+  };
+
   explicit WIARVZFileReader(File::IOFile file, const std::string& path);
   bool Initialize(const std::string& path);
   bool HasDataOverlap() const;
@@ -236,9 +284,18 @@ private:
   bool ReadFromGroups(u64* offset, u64* size, u8** out_ptr, u64 chunk_size, u32 sector_size,
                       u64 data_offset, u64 data_size, u32 group_index, u32 number_of_groups,
                       u32 exception_lists);
+  std::optional<ChunkParameters> GetGroupChunkParameters(u64 total_group_index, u64 chunk_size,
+                                                        u64 group_offset_in_data,
+                                                        u32 exception_lists) const;
   Chunk& ReadCompressedData(u64 offset_in_file, u64 compressed_size, u64 decompressed_size,
                             WIARVZCompressionType compression_type, u32 exception_lists = 0,
                             u32 rvz_packed_size = 0, u64 data_offset = 0);
+  Chunk& ReadCompressedData(const ChunkParameters& parameters);
+  Chunk CreateChunk(File::IOFile* file, const ChunkParameters& parameters) const;
+  void InvalidateCachedChunk(u64 offset_in_file);
+
+  void QueueReadAhead(const ChunkParameters& parameters);
+  void ReadAhead(const ChunkParameters& parameters);
 
   static bool ApplyHashExceptions(const std::vector<HashExceptionEntry>& exception_list,
                                   VolumeWii::HashBlock hash_blocks[VolumeWii::BLOCKS_PER_GROUP]);
@@ -365,8 +422,28 @@ private:
   WIARVZCompressionType m_compression_type;
 
   File::IOFile m_file;
-  Chunk m_cached_chunk;
-  u64 m_cached_chunk_offset = std::numeric_limits<u64>::max();
+  std::string m_path;
+
+  // Decompressed chunks, the least recently used of which is replaced when the cache is full.
+  // Accessing groups of different parts of the disc in turn (e.g. streamed audio and level data)
+  // would otherwise decompress the same chunks over and over.
+  static constexpr size_t MAX_CACHED_CHUNKS = 8;
+  std::vector<CachedChunk> m_cached_chunks;
+  u64 m_chunk_use_counter = 0;
+
+  // When groups are read sequentially, the next few groups are decompressed ahead of time on a
+  // separate thread, which reads through its own handle of the file.
+  static constexpr u32 READ_AHEAD_GROUPS = 2;
+  u64 m_last_group_index = std::numeric_limits<u64>::max();
+  File::IOFile m_read_ahead_file;
+  std::mutex m_read_ahead_lock;
+  std::condition_variable m_read_ahead_cv;
+  std::map<u64, ReadAheadChunk> m_read_ahead_chunks;
+  Common::WorkQueueThread<ChunkParameters> m_read_ahead_thread;
+
+  ChunkCacheStatistics m_chunk_cache_statistics;
+  std::atomic<u64> m_decompression_time_us = 0;
+
   WiiEncryptionCache m_encryption_cache;
 
   std::vector<HashExceptionEntry> m_exception_list;
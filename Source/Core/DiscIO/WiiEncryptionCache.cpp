@@ -3,6 +3,7 @@
 
 #include "DiscIO/WiiEncryptionCache.h"
 
+#include <algorithm>
 #include <array>
 #include <cstring>
 #include <limits>
@@ -26,43 +27,58 @@ WiiEncryptionCache::EncryptGroup(u64 offset, u64 partition_data_offset,
                                  u64 partition_data_decrypted_size, const Key& key,
                                  const HashExceptionCallback& hash_exception_callback)
 {
-  // Only allocate memory if this function actually ends up getting called
-  if (!m_cache)
-  {
-    m_cache = std::make_unique<std::array<u8, VolumeWii::GROUP_TOTAL_SIZE>>();
-    m_cached_offset = std::numeric_limits<u64>::max();
-  }
-
   ASSERT(offset % VolumeWii::GROUP_TOTAL_SIZE == 0);
   const u64 group_offset_in_partition =
       offset / VolumeWii::GROUP_TOTAL_SIZE * VolumeWii::GROUP_DATA_SIZE;
   const u64 group_offset_on_disc = partition_data_offset + offset;
 
-  if (m_cached_offset != group_offset_on_disc)
+  const u64 use = ++m_use_counter;
+  for (CachedGroup& group : m_cache)
   {
-    std::function<void(VolumeWii::HashBlock * hash_blocks)> hash_exception_callback_2;
-
-    if (hash_exception_callback)
+    if (group.offset == group_offset_on_disc)
     {
-      hash_exception_callback_2 =
-          [offset, &hash_exception_callback](
-              VolumeWii::HashBlock hash_blocks[VolumeWii::BLOCKS_PER_GROUP]) {
-            return hash_exception_callback(hash_blocks, offset);
-          };
+      group.last_used = use;
+      return group.data.get();
     }
+  }
 
-    if (!VolumeWii::EncryptGroup(group_offset_in_partition, partition_data_offset,
-                                 partition_data_decrypted_size, key, m_blob, m_cache.get(),
-                                 hash_exception_callback_2))
-    {
-      m_cached_offset = std::numeric_limits<u64>::max();  // Invalidate the cache
-      return nullptr;
-    }
+  // Only allocate memory if this function actually ends up getting called
+  CachedGroup* group;
+  if (m_cache.size() < MAX_CACHED_GROUPS)
+  {
+    group = &m_cache.emplace_back();
+    group->data = std::make_unique<std::array<u8, VolumeWii::GROUP_TOTAL_SIZE>>();
+  }
+  else
+  {
+    group = &*std::min_element(m_cache.begin(), m_cache.end(), [](const auto& a, const auto& b) {
+      return a.last_used < b.last_used;
+    });
+  }
 
-    m_cached_offset = group_offset_on_disc;
+  std::function<void(VolumeWii::HashBlock * hash_blocks)> hash_exception_callback_2;
+
+  if (hash_exception_callback)
+  {
+    hash_exception_callback_2 =
+        [offset, &hash_exception_callback](
+            VolumeWii::HashBlock hash_blocks[VolumeWii::BLOCKS_PER_GROUP]) {
+          return hash_exception_callback(hash_blocks, offset);
+        };
   }
 
-  return m_cache.get();
+  if (!VolumeWii::EncryptGroup(group_offset_in_partition, partition_data_offset,
+                               partition_data_decrypted_size, key, m_blob, group->data.get(),
+                               hash_exception_callback_2))
+  {
+    group->offset = std::numeric_limits<u64>::max();  // Invalidate the cache
+    return nullptr;
+  }
+
+  group->offset = group_offset_on_disc;
+  group->last_used = use;
+
+  return group->data.get();
 }
 
 bool WiiEncryptionCache::EncryptGroups(u64 offset, u64 size, u8* out_ptr, u64 partition_data_offset,
@@ -4,11 +4,13 @@
 #include "DolphinNoGUI/Platform.h"
 
 #include <OptionParser.h>
+#include <algorithm>
 #include <cstddef>
 #include <cstdio>
 #include <cstring>
 #include <signal.h>
 #include <string>
+#include <variant>
 #include <vector>
 
 #ifndef _WIN32
@@ -17,12 +19,17 @@
 #include <Windows.h>
 #endif
 
+#include "Common/Config/Config.h"
 #include "Common/ScopeGuard.h"
 #include "Common/StringUtil.h"
 #include "Core/Boot/Boot.h"
 #include "Core/BootManager.h"
+#include "Core/Config/GraphicsSettings.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
 #include "Core/DolphinAnalytics.h"
+#include "Core/FifoPlayer/FifoBenchmark.h"
+#include "Core/FifoPlayer/FifoPlayer.h"
 #include "Core/Host.h"
 
 #include "UICommon/CommandLineParse.h"
@@ -210,6 +217,23 @@ int main(int argc, char* argv[])
             "macos"
 #endif
       });
+  parser->add_option("--fifo_benchmark")
+      .action("store")
+      .metavar("<file>")
+      .type("string")
+      .help("Play back a fifolog as fast as possible and write frame timings to a JSON file");
+  parser->add_option("--benchmark_first_frame")
+      .action("store")
+      .type("int")
+      .help("First frame of the fifolog to play back in --fifo_benchmark");
+  parser->add_option("--benchmark_last_frame")
+      .action("store")
+      .type("int")
+      .help("Last frame of the fifolog to play back in --fifo_benchmark");
+  parser->add_option("--benchmark_loops")
+      .action("store")
+      .type("int")
+      .help("Number of times the frame range is played back in --fifo_benchmark");
 
   optparse::Values& options = CommandLineParse::ParseArguments(parser.get(), argc, argv);
   std::vector<std::string> args = parser->args();
@@ -284,6 +308,37 @@ int main(int argc, char* argv[])
     return 1;
   }
 
+  std::unique_ptr<FifoBenchmark> fifo_benchmark;
+  std::string fifo_benchmark_log;
+  if (options.is_set("fifo_benchmark"))
+  {
+    if (!boot || !std::holds_alternative<BootParameters::DFF>(boot->parameters))
+    {
+      fprintf(stderr, "--fifo_benchmark requires a fifolog to be specified.\n");
+      return 1;
+    }
+    fifo_benchmark_log = std::get<BootParameters::DFF>(boot->parameters).dff_path;
+
+    const auto get_u32 = [&](const char* name) {
+      return static_cast<u32>(std::max(static_cast<int>(options.get(name)), 0));
+    };
+
+    FifoBenchmark::Options benchmark_options;
+    if (options.is_set("benchmark_first_frame"))
+      benchmark_options.first_frame = get_u32("benchmark_first_frame");
+    if (options.is_set("benchmark_last_frame"))
+      benchmark_options.last_frame = get_u32("benchmark_last_frame");
+    if (options.is_set("benchmark_loops"))
+      benchmark_options.loops = get_u32("benchmark_loops");
+
+    fifo_benchmark = std::make_unique<FifoBenchmark>(benchmark_options);
+    FifoPlayer::GetInstance().SetBenchmark(fifo_benchmark.get());
+
+    // Don't let the frame limiter or vsync get in the way of the measurements.
+    Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 0.0f);
+    Config::SetCurrent(Config::GFX_VSYNC, false);
+  }
+
   Core::AddOnStateChangedCallback([](Core::State state) {
     if (state == Core::State::Uninitialized)
       s_platform->Stop();
@@ -320,6 +375,17 @@ int main(int argc, char* argv[])
   Core::Shutdown();
   s_platform.reset();
 
+  if (fifo_benchmark)
+  {
+    FifoPlayer::GetInstance().SetBenchmark(nullptr);
+    if (!fifo_benchmark->WriteReport(static_cast<const char*>(options.get("fifo_benchmark")),
+                                     fifo_benchmark_log))
+    {
+      fprintf(stderr, "Failed to write the benchmark report\n");
+      return 1;
+    }
+  }
+
   return 0;
 }
 
@@ -25,6 +25,7 @@
 #include "Common/Logging/Log.h"
 #include "Common/StringUtil.h"
 #include "DiscIO/Blob.h"
+#include "DiscIO/CompressedBlob.h"
 #include "DiscIO/DiscUtils.h"
 #include "DiscIO/ScrubbedBlob.h"
 #include "DiscIO/WIABlob.h"
@@ -499,7 +500,8 @@ void ConvertDialog::Convert()
         success = std::async(std::launch::async, [&] {
           const bool good = DiscIO::ConvertToGCZ(
               blob_reader.get(), original_path, dst_path.toStdString(),
-              file->GetPlatform() == DiscIO::Platform::WiiDisc ? 1 : 0, block_size, callback);
+              file->GetPlatform() == DiscIO::Platform::WiiDisc ? 1 : 0, block_size,
+              DiscIO::GCZCompressionType::Deflate, DiscIO::GCZ_DEFLATE_LEVEL, callback);
           progress_dialog.Reset();
           return good;
         });
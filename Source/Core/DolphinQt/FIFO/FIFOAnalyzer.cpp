@@ -4,6 +4,7 @@
 #include "DolphinQt/FIFO/FIFOAnalyzer.h"
 
 #include <algorithm>
+#include <memory>
 
 #include <QGroupBox>
 #include <QHBoxLayout>
@@ -352,11 +353,14 @@ void FIFOAnalyzer::UpdateDetails()
   const u32 end_part_nr = items[0]->data(0, PART_END_ROLE).toUInt();
 
   const AnalyzedFrameInfo& frame_info = FifoPlayer::GetInstance().GetAnalyzedFrameInfo(frame_nr);
-  const auto& fifo_frame = FifoPlayer::GetInstance().GetFile()->GetFrame(frame_nr);
+  const std::shared_ptr<const FifoFrameInfo> fifo_frame =
+      FifoPlayer::GetInstance().GetFile()->GetFrame(frame_nr);
 
   const u32 object_start = frame_info.parts[start_part_nr].m_start;
   const u32 object_end = frame_info.parts[end_part_nr].m_end;
   const u32 object_size = object_end - object_start;
+  if (object_end > fifo_frame->fifoData.size())
+    return;
 
   u32 object_offset = 0;
   // NOTE: object_info.m_cpmem is the state of cpmem _after_ all of the commands in this object.
@@ -369,7 +373,7 @@ void FIFOAnalyzer::UpdateDetails()
     const u32 start_offset = object_offset;
     m_object_data_offsets.push_back(start_offset);
 
-    object_offset += OpcodeDecoder::RunCommand(&fifo_frame.fifoData[object_start + start_offset],
+    object_offset += OpcodeDecoder::RunCommand(&fifo_frame->fifoData[object_start + start_offset],
                                                object_size - start_offset, callback);
 
     QString new_label =
@@ -435,13 +439,16 @@ void FIFOAnalyzer::BeginSearch()
   const u32 end_part_nr = items[0]->data(0, PART_END_ROLE).toUInt();
 
   const AnalyzedFrameInfo& frame_info = FifoPlayer::GetInstance().GetAnalyzedFrameInfo(frame_nr);
-  const FifoFrameInfo& fifo_frame = FifoPlayer::GetInstance().GetFile()->GetFrame(frame_nr);
+  const std::shared_ptr<const FifoFrameInfo> fifo_frame =
+      FifoPlayer::GetInstance().GetFile()->GetFrame(frame_nr);
 
   const u32 object_start = frame_info.parts[start_part_nr].m_start;
   const u32 object_end = frame_info.parts[end_part_nr].m_end;
   const u32 object_size = object_end - object_start;
+  if (object_end > fifo_frame->fifoData.size())
+    return;
 
-  const u8* const object = &fifo_frame.fifoData[object_start];
+  const u8* const object = &fifo_frame->fifoData[object_start];
 
   // TODO: Support searching for bit patterns
   for (u32 cmd_nr = 0; cmd_nr < m_object_data_offsets.size(); cmd_nr++)
@@ -767,15 +774,18 @@ void FIFOAnalyzer::UpdateDescription()
   const u32 entry_nr = m_detail_list->currentRow();
 
   const AnalyzedFrameInfo& frame_info = FifoPlayer::GetInstance().GetAnalyzedFrameInfo(frame_nr);
-  const FifoFrameInfo& fifo_frame = FifoPlayer::GetInstance().GetFile()->GetFrame(frame_nr);
+  const std::shared_ptr<const FifoFrameInfo> fifo_frame =
+      FifoPlayer::GetInstance().GetFile()->GetFrame(frame_nr);
 
   const u32 object_start = frame_info.parts[start_part_nr].m_start;
   const u32 object_end = frame_info.parts[end_part_nr].m_end;
   const u32 object_size = object_end - object_start;
   const u32 entry_start = m_object_data_offsets[entry_nr];
+  if (object_end > fifo_frame->fifoData.size())
+    return;
 
   auto callback = DescriptionCallback(frame_info.parts[end_part_nr].m_cpmem);
-  OpcodeDecoder::RunCommand(&fifo_frame.fifoData[object_start + entry_start],
+  OpcodeDecoder::RunCommand(&fifo_frame->fifoData[object_start + entry_start],
                             object_size - entry_start, callback);
   m_entry_detail_browser->setText(callback.text);
 }
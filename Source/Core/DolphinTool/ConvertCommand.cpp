@@ -3,19 +3,33 @@
 
 #include "DolphinTool/ConvertCommand.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
+#include <filesystem>
 #include <iostream>
 #include <limits>
+#include <map>
+#include <mutex>
 #include <optional>
+#include <string_view>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <OptionParser.h>
 #include <fmt/format.h>
+#include <fmt/ranges.h>
 #include <fmt/ostream.h>
 
 #include "Common/CommonTypes.h"
+#include "Common/FileSearch.h"
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
+#include "Common/ThreadPool.h"
 #include "DiscIO/Blob.h"
+#include "DiscIO/ChunkStoreBlob.h"
+#include "DiscIO/CompressedBlob.h"
 #include "DiscIO/DiscUtils.h"
 #include "DiscIO/ScrubbedBlob.h"
 #include "DiscIO/Volume.h"
@@ -53,14 +67,285 @@ static std::optional<DiscIO::BlobType> ParseFormatString(const std::string& form
     return DiscIO::BlobType::WIA;
   else if (format_str == "rvz")
     return DiscIO::BlobType::RVZ;
+  else if (format_str == "dcs")
+    return DiscIO::BlobType::CHUNK_STORE;
   return std::nullopt;
 }
 
+static const char* GetFormatExtension(DiscIO::BlobType format)
+{
+  switch (format)
+  {
+  case DiscIO::BlobType::GCZ:
+    return ".gcz";
+  case DiscIO::BlobType::WIA:
+    return ".wia";
+  case DiscIO::BlobType::RVZ:
+    return ".rvz";
+  case DiscIO::BlobType::CHUNK_STORE:
+    return ".dcs";
+  default:
+    return ".iso";
+  }
+}
+
+struct ConvertSettings
+{
+  DiscIO::BlobType format;
+  bool scrub;
+  std::optional<int> block_size;
+  std::optional<DiscIO::WIARVZCompressionType> compression;
+  std::optional<int> compression_level;
+  std::string store_path;
+};
+
+// Prints errors and warnings for the given file, and converts it if possible.
+// num_threads is passed on to the compressor, 0 means one thread per core.
+// When several files are converted at once, print_lock is held while printing, and the messages
+// are prefixed with the input file so that they can be told apart.
+static bool ConvertFile(const ConvertSettings& settings, const std::string& input_file_path,
+                        const std::string& output_file_path, unsigned int num_threads,
+                        std::mutex* print_lock = nullptr)
+{
+  const auto print_error = [&](std::string_view message) {
+    std::unique_lock<std::mutex> lk;
+    if (print_lock)
+    {
+      lk = std::unique_lock(*print_lock);
+      fmt::print(std::cerr, "{}: ", input_file_path);
+    }
+    fmt::print(std::cerr, "{}", message);
+  };
+
+  const DiscIO::BlobType format = settings.format;
+  const bool scrub = settings.scrub;
+
+  // Open the blob reader
+  std::unique_ptr<DiscIO::BlobReader> blob_reader = DiscIO::CreateBlobReader(input_file_path);
+  if (!blob_reader)
+  {
+    print_error("Error: The input file could not be opened.\n");
+    return false;
+  }
+
+  // Open the volume
+  std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateDisc(input_file_path);
+  if (!volume)
+  {
+    if (scrub)
+    {
+      print_error("Error: Scrubbing is only supported for GC/Wii disc images.\n");
+      return false;
+    }
+
+    print_error("Warning: The input file is not a GC/Wii disc image. Continuing anyway.\n");
+  }
+
+  if (scrub)
+  {
+    if (volume->IsDatelDisc())
+    {
+      print_error("Error: Scrubbing a Datel disc is not supported.\n");
+      return false;
+    }
+
+    blob_reader = DiscIO::ScrubbedBlob::Create(input_file_path);
+
+    if (!blob_reader)
+    {
+      print_error("Error: Unable to process disc image. Try again without --scrub.\n");
+      return false;
+    }
+  }
+
+  if (!scrub && format == DiscIO::BlobType::GCZ && volume &&
+      volume->GetVolumeType() == DiscIO::Platform::WiiDisc && !volume->IsDatelDisc())
+  {
+    print_error("Warning: Converting Wii disc images to GCZ without scrubbing may not "
+                "offer space advantages over ISO. Continuing anyway.\n");
+  }
+
+  if (format == DiscIO::BlobType::CHUNK_STORE && volume &&
+      volume->GetVolumeType() == DiscIO::Platform::WiiDisc && !volume->IsDatelDisc())
+  {
+    print_error("Warning: The encrypted partitions of Wii disc images can't be shared with "
+                "other disc images in a chunk store, and barely compress. Continuing anyway.\n");
+  }
+
+  if (volume && volume->IsNKit())
+  {
+    print_error(
+        "Warning: Converting an NKit file, output will still be NKit! Continuing anyway.\n");
+  }
+
+  if (format == DiscIO::BlobType::GCZ && volume &&
+      !DiscIO::IsGCZBlockSizeLegacyCompatible(settings.block_size.value(), volume->GetDataSize()))
+  {
+    print_error("Warning: For GCZs to be compatible with Dolphin < 5.0-11893, the file "
+                "size must be an integer multiple of the block size and must not be an "
+                "integer multiple of the block size multiplied by 32. Continuing "
+                "anyway.\n");
+  }
+
+  // Perform the conversion
+  const auto NOOP_STATUS_CALLBACK = [](const std::string& text, float percent) { return true; };
+
+  bool success = false;
+
+  switch (format)
+  {
+  case DiscIO::BlobType::PLAIN:
+  {
+    success = DiscIO::ConvertToPlain(blob_reader.get(), input_file_path, output_file_path,
+                                     NOOP_STATUS_CALLBACK);
+    break;
+  }
+
+  case DiscIO::BlobType::GCZ:
+  {
+    u32 sub_type = std::numeric_limits<u32>::max();
+    if (volume)
+    {
+      if (volume->GetVolumeType() == DiscIO::Platform::GameCubeDisc)
+        sub_type = 0;
+      else if (volume->GetVolumeType() == DiscIO::Platform::WiiDisc)
+        sub_type = 1;
+    }
+    const bool zstd = settings.compression == DiscIO::WIARVZCompressionType::Zstd;
+    success = DiscIO::ConvertToGCZ(
+        blob_reader.get(), input_file_path, output_file_path, sub_type,
+        settings.block_size.value(),
+        zstd ? DiscIO::GCZCompressionType::Zstd : DiscIO::GCZCompressionType::Deflate,
+        zstd ? settings.compression_level.value() : DiscIO::GCZ_DEFLATE_LEVEL,
+        NOOP_STATUS_CALLBACK, num_threads);
+    break;
+  }
+
+  case DiscIO::BlobType::WIA:
+  case DiscIO::BlobType::RVZ:
+  {
+    success = DiscIO::ConvertToWIAOrRVZ(
+        blob_reader.get(), input_file_path, output_file_path, format == DiscIO::BlobType::RVZ,
+        settings.compression.value(), settings.compression_level.value(),
+        settings.block_size.value(), NOOP_STATUS_CALLBACK, num_threads);
+    break;
+  }
+
+  case DiscIO::BlobType::CHUNK_STORE:
+  {
+    success = DiscIO::ConvertToChunkStore(
+        blob_reader.get(), input_file_path, output_file_path, settings.store_path,
+        settings.block_size.value(), settings.compression_level.value(), NOOP_STATUS_CALLBACK,
+        num_threads);
+    break;
+  }
+
+  default:
+  {
+    ASSERT(false);
+    break;
+  }
+  }
+
+  return success;
+}
+
+// Converts every disc image in input_dir, keeping the directory structure in output_dir.
+// Up to 'jobs' files are converted at the same time, sharing 'threads' compression threads.
+// Files whose output already exists are skipped, so an interrupted batch can be resumed.
+static int ConvertBatch(const ConvertSettings& settings, const std::string& input_dir,
+                        const std::string& output_dir, u32 jobs, u32 threads)
+{
+  static const std::vector<std::string> search_extensions = {
+      ".gcm", ".tgc", ".iso", ".ciso", ".gcz", ".wbfs", ".wia", ".rvz", ".nfs", ".dcs"};
+  const std::vector<std::string> input_files =
+      Common::DoFileSearch({input_dir}, search_extensions, true);
+
+  std::mutex print_lock;
+  std::atomic<u32> files_converted = 0;
+  std::atomic<u32> files_skipped = 0;
+  std::atomic<u32> files_failed = 0;
+
+  jobs = std::clamp<u32>(jobs, 1, std::max<u32>(1, static_cast<u32>(input_files.size())));
+  const u32 threads_per_job = std::max<u32>(1, threads / jobs);
+
+  // The calling thread only waits, so all of the jobs run on the pool
+  Common::ThreadPool pool("Convert", jobs);
+
+  const std::filesystem::path input_root = StringToPath(input_dir);
+  const std::filesystem::path output_root = StringToPath(output_dir);
+
+  // Inputs which only differ in their extension (like game.iso and game.wbfs) would be converted
+  // to the same output, so find all of the outputs before any conversion starts
+  std::map<std::string, std::vector<std::string>> outputs;
+  for (const std::string& input_file_path : input_files)
+  {
+    std::filesystem::path output_path =
+        output_root / StringToPath(input_file_path).lexically_relative(input_root);
+    output_path.replace_extension(GetFormatExtension(settings.format));
+    outputs[PathToString(output_path)].push_back(input_file_path);
+  }
+
+  for (const auto& [output_file_path, inputs] : outputs)
+  {
+    if (inputs.size() > 1)
+    {
+      fmt::print(std::cerr, "Error: {} would all be converted to {}, skipping them\n",
+                 fmt::join(inputs, ", "), output_file_path);
+      files_failed += static_cast<u32>(inputs.size());
+      continue;
+    }
+
+    if (File::Exists(output_file_path))
+    {
+      ++files_skipped;
+      continue;
+    }
+
+    const std::string& input_file_path = inputs.front();
+    pool.Push([&, input_file_path, output_file_path] {
+      {
+        std::lock_guard lk(print_lock);
+        fmt::print(std::cout, "Converting {}\n", input_file_path);
+      }
+
+      // Write to a temporary file first, so that an interrupted conversion isn't mistaken for a
+      // finished one when the batch is resumed
+      const std::string temp_file_path = output_file_path + ".part";
+      File::CreateFullPath(temp_file_path);
+      const bool success = ConvertFile(settings, input_file_path, temp_file_path,
+                                       threads_per_job, &print_lock) &&
+                           File::Rename(temp_file_path, output_file_path);
+
+      std::lock_guard lk(print_lock);
+      if (success)
+      {
+        ++files_converted;
+        fmt::print(std::cout, "Converted {}\n", output_file_path);
+      }
+      else
+      {
+        ++files_failed;
+        File::Delete(temp_file_path);
+        fmt::print(std::cerr, "Error: Conversion of {} failed\n", input_file_path);
+      }
+    });
+  }
+
+  pool.WaitForCompletion();
+
+  fmt::print(std::cout, "{} converted, {} skipped because the output exists, {} failed\n",
+             files_converted.load(), files_skipped.load(), files_failed.load());
+
+  return files_failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
 int ConvertCommand(const std::vector<std::string>& args)
 {
   optparse::OptionParser parser;
 
-  parser.usage("usage: convert [options]... [FILE]...");
+  parser.usage("usage: convert [options]... [FILE]...\n"
+               "       convert --batch [options]... -i DIRECTORY -o DIRECTORY");
 
   parser.add_option("-u", "--user")
       .type("string")
@@ -84,8 +369,9 @@ int ConvertCommand(const std::vector<std::string>& args)
   parser.add_option("-f", "--format")
       .type("string")
       .action("store")
-      .help("Container format to use. Default is RVZ. [%choices]")
-      .choices({"iso", "gcz", "wia", "rvz"});
+      .help("Container format to use. Default is RVZ. 'dcs' adds the disc to a chunk store "
+            "shared by many disc images and writes a small manifest file. [%choices]")
+      .choices({"iso", "gcz", "wia", "rvz", "dcs"});
 
   parser.add_option("-s", "--scrub")
       .action("store_true")
@@ -94,21 +380,47 @@ int ConvertCommand(const std::vector<std::string>& args)
   parser.add_option("-b", "--block_size")
       .type("int")
       .action("store")
-      .help("Block size for GCZ/WIA/RVZ formats, as an integer. Suggested value for RVZ: 131072 "
-            "(128 KiB)");
+      .help("Block size for GCZ/WIA/RVZ/DCS formats, as an integer. Suggested value for RVZ and "
+            "DCS: 131072 (128 KiB)");
 
   parser.add_option("-c", "--compression")
       .type("string")
       .action("store")
-      .help("Compression method to use when converting to WIA/RVZ. Suggested value for RVZ: zstd "
-            "[%choices]")
+      .help("Compression method to use when converting to WIA/RVZ. For GCZ, zstd creates a GCZ v2 "
+            "file, which is faster to decompress but can't be read by older versions of Dolphin. "
+            "Suggested value for RVZ: zstd [%choices]")
       .choices({"none", "zstd", "bzip", "lzma", "lzma2"});
 
   parser.add_option("-l", "--compression_level")
       .type("int")
       .action("store")
-      .help("Level of compression for the selected method. Ignored if 'none'. Suggested value for "
-            "zstd: 5");
+      .help("Level of compression for the selected method. Ignored if 'none'. DCS always uses "
+            "zstd. Suggested value for zstd: 5");
+
+  parser.add_option("--store")
+      .type("string")
+      .action("store")
+      .help("Path to the chunk store DIRECTORY when converting to DCS. Will be created if it "
+            "doesn't exist. The same store should be used for all discs to share their data.")
+      .metavar("DIRECTORY");
+
+  parser.add_option("--batch")
+      .action("store_true")
+      .help("Convert every disc image in the input directory and its subdirectories. The output is "
+            "a directory with the same structure. Files whose output already exists are "
+            "skipped.");
+
+  parser.add_option("-j", "--jobs")
+      .type("int")
+      .action("store")
+      .help("Number of files to convert at the same time in batch mode. Default is 2.")
+      .set_default(2);
+
+  parser.add_option("-t", "--threads")
+      .type("int")
+      .action("store")
+      .help("Total number of compression threads, shared by all jobs. Default is the number of "
+            "CPU cores.");
 
   const optparse::Values& options = parser.parse_args(args);
 
@@ -144,48 +456,9 @@ int ConvertCommand(const std::vector<std::string>& args)
   }
   const DiscIO::BlobType format = format_o.value();
 
-  // Open the blob reader
-  std::unique_ptr<DiscIO::BlobReader> blob_reader = DiscIO::CreateBlobReader(input_file_path);
-  if (!blob_reader)
-  {
-    fmt::print(std::cerr, "Error: The input file could not be opened.\n");
-    return EXIT_FAILURE;
-  }
-
   // --scrub
   const bool scrub = static_cast<bool>(options.get("scrub"));
 
-  // Open the volume
-  std::unique_ptr<DiscIO::Volume> volume = DiscIO::CreateDisc(input_file_path);
-  if (!volume)
-  {
-    if (scrub)
-    {
-      fmt::print(std::cerr, "Error: Scrubbing is only supported for GC/Wii disc images.\n");
-      return EXIT_FAILURE;
-    }
-
-    fmt::print(std::cerr,
-               "Warning: The input file is not a GC/Wii disc image. Continuing anyway.\n");
-  }
-
-  if (scrub)
-  {
-    if (volume->IsDatelDisc())
-    {
-      fmt::print(std::cerr, "Error: Scrubbing a Datel disc is not supported.\n");
-      return EXIT_FAILURE;
-    }
-
-    blob_reader = DiscIO::ScrubbedBlob::Create(input_file_path);
-
-    if (!blob_reader)
-    {
-      fmt::print(std::cerr, "Error: Unable to process disc image. Try again without --scrub.\n");
-      return EXIT_FAILURE;
-    }
-  }
-
   if (scrub && format == DiscIO::BlobType::RVZ)
   {
     fmt::print(std::cerr, "Warning: Scrubbing an RVZ container does not offer significant space "
@@ -198,30 +471,17 @@ int ConvertCommand(const std::vector<std::string>& args)
                           "using external compression. Continuing anyway.\n");
   }
 
-  if (!scrub && format == DiscIO::BlobType::GCZ && volume &&
-      volume->GetVolumeType() == DiscIO::Platform::WiiDisc && !volume->IsDatelDisc())
-  {
-    fmt::print(std::cerr, "Warning: Converting Wii disc images to GCZ without scrubbing may not "
-                          "offer space advantages over ISO. Continuing anyway.\n");
-  }
-
-  if (volume && volume->IsNKit())
-  {
-    fmt::print(std::cerr,
-               "Warning: Converting an NKit file, output will still be NKit! Continuing anyway.\n");
-  }
-
   // --block_size
   std::optional<int> block_size_o;
   if (options.is_set("block_size"))
     block_size_o = static_cast<int>(options.get("block_size"));
 
   if (format == DiscIO::BlobType::GCZ || format == DiscIO::BlobType::WIA ||
-      format == DiscIO::BlobType::RVZ)
+      format == DiscIO::BlobType::RVZ || format == DiscIO::BlobType::CHUNK_STORE)
   {
     if (!block_size_o.has_value())
     {
-      fmt::print(std::cerr, "Error: Block size must be set for GCZ/RVZ/WIA\n");
+      fmt::print(std::cerr, "Error: Block size must be set for GCZ/RVZ/WIA/DCS\n");
       return EXIT_FAILURE;
     }
 
@@ -237,15 +497,6 @@ int ConvertCommand(const std::vector<std::string>& args)
       fmt::print(std::cerr,
                  "Warning: Block size is not ideal for performance. Continuing anyway.\n");
     }
-
-    if (format == DiscIO::BlobType::GCZ && volume &&
-        !DiscIO::IsGCZBlockSizeLegacyCompatible(block_size_o.value(), volume->GetDataSize()))
-    {
-      fmt::print(std::cerr,
-                 "Warning: For GCZs to be compatible with Dolphin < 5.0-11893, the file size "
-                 "must be an integer multiple of the block size and must not be an integer "
-                 "multiple of the block size multiplied by 32. Continuing anyway.\n");
-    }
   }
 
   // --compress, --compress_level
@@ -296,53 +547,87 @@ int ConvertCommand(const std::vector<std::string>& args)
     }
   }
 
-  // Perform the conversion
-  const auto NOOP_STATUS_CALLBACK = [](const std::string& text, float percent) { return true; };
+  if (format == DiscIO::BlobType::GCZ && compression_o.has_value())
+  {
+    if (compression_o.value() != DiscIO::WIARVZCompressionType::Zstd)
+    {
+      fmt::print(std::cerr, "Error: Compression type is not supported for the container format\n");
+      return EXIT_FAILURE;
+    }
 
-  bool success = false;
+    if (!compression_level_o.has_value())
+    {
+      fmt::print(std::cerr,
+                 "Error: Compression level must be set when compression type is not 'none'\n");
+      return EXIT_FAILURE;
+    }
 
-  switch (format)
-  {
-  case DiscIO::BlobType::PLAIN:
-  {
-    success = DiscIO::ConvertToPlain(blob_reader.get(), input_file_path, output_file_path,
-                                     NOOP_STATUS_CALLBACK);
-    break;
+    const std::pair<int, int> range =
+        DiscIO::GetAllowedCompressionLevels(DiscIO::WIARVZCompressionType::Zstd, false);
+    if (compression_level_o.value() < range.first || compression_level_o.value() > range.second)
+    {
+      fmt::print(std::cerr, "Error: Compression level not in acceptable range\n");
+      return EXIT_FAILURE;
+    }
   }
 
-  case DiscIO::BlobType::GCZ:
+  // --store
+  std::string store_path;
+  if (format == DiscIO::BlobType::CHUNK_STORE)
   {
-    u32 sub_type = std::numeric_limits<u32>::max();
-    if (volume)
+    if (!options.is_set("store"))
     {
-      if (volume->GetVolumeType() == DiscIO::Platform::GameCubeDisc)
-        sub_type = 0;
-      else if (volume->GetVolumeType() == DiscIO::Platform::WiiDisc)
-        sub_type = 1;
+      fmt::print(std::cerr, "Error: Chunk store must be set for DCS\n");
+      return EXIT_FAILURE;
     }
-    success = DiscIO::ConvertToGCZ(blob_reader.get(), input_file_path, output_file_path, sub_type,
-                                   block_size_o.value(), NOOP_STATUS_CALLBACK);
-    break;
-  }
+    store_path = options["store"];
 
-  case DiscIO::BlobType::WIA:
-  case DiscIO::BlobType::RVZ:
-  {
-    success = DiscIO::ConvertToWIAOrRVZ(blob_reader.get(), input_file_path, output_file_path,
-                                        format == DiscIO::BlobType::RVZ, compression_o.value(),
-                                        compression_level_o.value(), block_size_o.value(),
-                                        NOOP_STATUS_CALLBACK);
-    break;
+    if (!compression_level_o.has_value())
+    {
+      fmt::print(std::cerr, "Error: Compression level must be set for DCS\n");
+      return EXIT_FAILURE;
+    }
+
+    const std::pair<int, int> range =
+        DiscIO::GetAllowedCompressionLevels(DiscIO::WIARVZCompressionType::Zstd, false);
+    if (compression_level_o.value() < range.first || compression_level_o.value() > range.second)
+    {
+      fmt::print(std::cerr, "Error: Compression level not in acceptable range\n");
+      return EXIT_FAILURE;
+    }
   }
 
-  default:
+  const ConvertSettings settings{format, scrub, block_size_o, compression_o, compression_level_o,
+                                 std::move(store_path)};
+
+  // --batch, --jobs, --threads
+  if (options.get("batch"))
   {
-    ASSERT(false);
-    break;
-  }
+    if (!File::IsDirectory(input_file_path))
+    {
+      fmt::print(std::cerr, "Error: The input must be a directory in batch mode\n");
+      return EXIT_FAILURE;
+    }
+
+    const int jobs = static_cast<int>(options.get("jobs"));
+    const int threads = options.is_set("threads") ?
+                            static_cast<int>(options.get("threads")) :
+                            static_cast<int>(std::thread::hardware_concurrency());
+    if (jobs < 1 || threads < 1)
+    {
+      fmt::print(std::cerr, "Error: The number of jobs and threads must be at least 1\n");
+      return EXIT_FAILURE;
+    }
+
+    return ConvertBatch(settings, input_file_path, output_file_path, static_cast<u32>(jobs),
+                        static_cast<u32>(threads));
   }
 
-  if (!success)
+  unsigned int threads = 0;
+  if (options.is_set("threads"))
+    threads = static_cast<unsigned int>(std::max(1, static_cast<int>(options.get("threads"))));
+
+  if (!ConvertFile(settings, input_file_path, output_file_path, threads))
   {
     fmt::print(std::cerr, "Error: Conversion failed\n");
     return EXIT_FAILURE;
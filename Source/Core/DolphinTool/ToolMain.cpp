@@ -18,13 +18,14 @@
 
 #include "DolphinTool/ConvertCommand.h"
 #include "DolphinTool/HeaderCommand.h"
+#include "DolphinTool/UIDCorpusCommand.h"
 #include "DolphinTool/VerifyCommand.h"
 
 static void PrintUsage()
 {
   fmt::print(std::cerr, "usage: dolphin-tool COMMAND -h\n"
                         "\n"
-                        "commands supported: [convert, verify, header]\n");
+                        "commands supported: [convert, verify, header, uidcorpus]\n");
 }
 
 #ifdef _WIN32
@@ -51,6 +52,8 @@ int main(int argc, char* argv[])
     return DolphinTool::VerifyCommand(args);
   else if (command_str == "header")
     return DolphinTool::HeaderCommand(args);
+  else if (command_str == "uidcorpus")
+    return DolphinTool::UIDCorpusCommand(args);
   PrintUsage();
   return EXIT_FAILURE;
 }
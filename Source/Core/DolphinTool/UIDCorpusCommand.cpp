@@ -0,0 +1,92 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinTool/UIDCorpusCommand.h"
+
+#include <cstdlib>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <OptionParser.h>
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include "Common/FileUtil.h"
+#include "UICommon/UICommon.h"
+#include "VideoCommon/PipelineUIDCorpus.h"
+
+namespace DolphinTool
+{
+int UIDCorpusCommand(const std::vector<std::string>& args)
+{
+  optparse::OptionParser parser;
+
+  parser.usage("usage: uidcorpus [options]...");
+
+  parser.add_option("-u", "--user")
+      .type("string")
+      .action("store")
+      .help("User folder path. The pipeline UID caches are read from its Cache folder, and the "
+            "corpus is written there, unless other paths are given.")
+      .set_default("");
+
+  parser.add_option("-i", "--input")
+      .type("string")
+      .action("append")
+      .help("Optional. Folder containing pipeline UID caches (.uidcache) gathered from any number "
+            "of games. Can be given more than once.")
+      .metavar("FOLDER");
+
+  parser.add_option("-o", "--output")
+      .type("string")
+      .action("store")
+      .help("Optional. Path to write the corpus FILE to.")
+      .metavar("FILE");
+
+  parser.add_option("-n", "--max_uids")
+      .type("int")
+      .action("store")
+      .help("Optional. Only keep the N most commonly used UIDs. [default: %default]")
+      .set_default(65536)
+      .metavar("N");
+
+  const optparse::Values& options = parser.parse_args(args);
+
+  UICommon::SetUserDirectory(options["user"]);
+  UICommon::Init();
+
+  std::vector<std::string> input_paths;
+  if (options.is_set("input"))
+  {
+    const std::list<std::string>& inputs = options.all("input");
+    input_paths.assign(inputs.begin(), inputs.end());
+  }
+  else
+  {
+    input_paths.push_back(File::GetUserPath(D_CACHE_IDX));
+  }
+
+  const std::string output_path =
+      options.is_set("output") ? options["output"] : VideoCommon::GetPipelineUIDCorpusPath();
+
+  const int max_uids = static_cast<int>(options.get("max_uids"));
+  if (max_uids <= 0)
+  {
+    fmt::print(std::cerr, "Error: max_uids must be positive\n");
+    return EXIT_FAILURE;
+  }
+
+  const auto stats = VideoCommon::BuildPipelineUIDCorpus(input_paths, output_path,
+                                                         static_cast<u32>(max_uids));
+  if (!stats)
+  {
+    fmt::print(std::cerr, "Error: Unable to write corpus to {}\n", output_path);
+    return EXIT_FAILURE;
+  }
+
+  fmt::print(std::cout, "Wrote {} pipeline UIDs from {} caches to {}\n", stats->num_uids,
+             stats->num_caches, output_path);
+  return EXIT_SUCCESS;
+}
+}  // namespace DolphinTool
@@ -7,6 +7,7 @@
 #include <array>
 #include <cstdio>
 #include <cstring>
+#include <filesystem>
 #include <iterator>
 #include <map>
 #include <memory>
@@ -114,6 +115,7 @@ GameFile::GameFile() = default;
 GameFile::GameFile(std::string path) : m_file_path(std::move(path))
 {
   m_file_name = PathToFileName(m_file_path);
+  m_file_stamp = GetFileStamp(m_file_path);
 
   {
     std::unique_ptr<DiscIO::Volume> volume(DiscIO::CreateVolume(m_file_path));
@@ -196,6 +198,25 @@ GameFile::GameFile(std::string path) : m_file_path(std::move(path))
 
 GameFile::~GameFile() = default;
 
+GameFile::FileStamp GameFile::GetFileStamp(const std::string& path)
+{
+  std::error_code error;
+  const std::filesystem::path fs_path = StringToPath(path);
+  const u64 size = std::filesystem::file_size(fs_path, error);
+  if (error)
+    return {};
+  const auto last_write_time = std::filesystem::last_write_time(fs_path, error);
+  if (error)
+    return {};
+
+  return {size, static_cast<s64>(last_write_time.time_since_epoch().count())};
+}
+
+bool GameFile::FileChangedOnDisk() const
+{
+  return GetFileStamp(m_file_path) != m_file_stamp;
+}
+
 bool GameFile::IsValid() const
 {
   if (!m_valid)
@@ -305,6 +326,7 @@ void GameFile::DoState(PointerWrap& p)
   p.Do(m_valid);
   p.Do(m_file_path);
   p.Do(m_file_name);
+  p.Do(m_file_stamp);
 
   p.Do(m_file_size);
   p.Do(m_volume_size);
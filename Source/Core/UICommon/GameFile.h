@@ -111,6 +111,9 @@ public:
   const GameBanner& GetBannerImage() const;
   const GameCover& GetCoverImage() const;
   void DoState(PointerWrap& p);
+  // Returns true if the file has been modified or replaced since this object was created.
+  // This function is slow if the file is on network storage.
+  bool FileChangedOnDisk() const;
   bool XMLMetadataChanged();
   void XMLMetadataCommit();
   bool WiiBannerChanged();
@@ -124,6 +127,17 @@ public:
   void CustomCoverCommit();
 
 private:
+  // Identifies a version of a file on disk without reading its contents.
+  struct FileStamp
+  {
+    u64 size{};
+    s64 last_write_time{};
+
+    bool operator==(const FileStamp&) const = default;
+  };
+
+  static FileStamp GetFileStamp(const std::string& path);
+
   DiscIO::Language GetConfigLanguage() const;
   static const std::string& Lookup(DiscIO::Language language,
                                    const std::map<DiscIO::Language, std::string>& strings);
@@ -142,6 +156,7 @@ private:
   bool m_valid{};
   std::string m_file_path;
   std::string m_file_name;
+  FileStamp m_file_stamp{};
 
   u64 m_file_size{};
   u64 m_volume_size{};
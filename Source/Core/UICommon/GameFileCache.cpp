@@ -4,11 +4,13 @@
 #include "UICommon/GameFileCache.h"
 
 #include <algorithm>
+#include <condition_variable>
 #include <cstddef>
 #include <functional>
 #include <list>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <unordered_set>
 #include <utility>
@@ -19,6 +21,7 @@
 #include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
+#include "Common/ThreadPool.h"
 
 #include "DiscIO/DirectoryBlob.h"
 
@@ -26,19 +29,74 @@
 
 namespace UICommon
 {
-static constexpr u32 CACHE_REVISION = 24;  // Last changed in PR 11557
+// Last changed when chunk store manifests were added and replaced files started being detected
+static constexpr u32 CACHE_REVISION = 26;
 
 std::vector<std::string> FindAllGamePaths(const std::vector<std::string>& directories_to_scan,
                                           bool recursive_scan)
 {
   static const std::vector<std::string> search_extensions = {
       ".gcm", ".tgc", ".iso", ".ciso", ".gcz", ".wbfs", ".wia",
-      ".rvz", ".nfs", ".wad", ".dol",  ".elf", ".json"};
+      ".rvz", ".nfs", ".dcs", ".wad",  ".dol", ".elf",  ".json"};
 
   // TODO: We could process paths iteratively as they are found
   return Common::DoFileSearch(directories_to_scan, search_extensions, recursive_scan);
 }
 
+// Scanning mostly waits for the storage (which may be a network share), so more threads than
+// there are CPU cores are useful, but too many would just queue up requests on the storage.
+static constexpr u32 SCAN_THREADS = 8;
+
+// Calls process(i) for every i in [0, count) on a pool of scan threads, and calls on_done(i,
+// result) on the calling thread as the results come in, in no particular order. Once
+// processing_halted is set, the remaining indices are skipped.
+template <typename Result>
+static void ProcessInParallel(size_t count, const std::function<Result(size_t)>& process,
+                              const std::function<void(size_t, Result)>& on_done,
+                              const std::atomic_bool& processing_halted)
+{
+  if (count == 0)
+    return;
+
+  std::mutex lock;
+  std::condition_variable cond_var;
+  std::vector<std::pair<size_t, Result>> results;
+  size_t remaining = count;
+
+  Common::ThreadPool pool("Game Scan", static_cast<u32>(std::min<size_t>(SCAN_THREADS, count)));
+  for (size_t i = 0; i < count; i++)
+  {
+    pool.Push([&, i] {
+      std::optional<Result> result;
+      if (!processing_halted)
+        result = process(i);
+
+      std::lock_guard lk(lock);
+      if (result)
+        results.emplace_back(i, std::move(*result));
+      remaining--;
+      cond_var.notify_one();
+    });
+  }
+
+  std::vector<std::pair<size_t, Result>> finished;
+  while (true)
+  {
+    std::unique_lock lk(lock);
+    cond_var.wait(lk, [&] { return !results.empty() || remaining == 0; });
+    finished.swap(results);
+    const bool done = remaining == 0;
+    lk.unlock();
+
+    for (auto& [i, result] : finished)
+      on_done(i, std::move(result));
+    finished.clear();
+
+    if (done)
+      break;
+  }
+}
+
 GameFileCache::GameFileCache() : m_path(File::GetUserPath(D_CACHE_IDX) + "gamelist.cache")
 {
 }
@@ -102,6 +160,17 @@ bool GameFileCache::Update(
 
   bool cache_changed = false;
 
+  // Files which are still there but have been modified since they were cached are removed from
+  // the cache and scanned again like new files.
+  std::vector<char> changed_on_disk(m_cached_files.size());
+  ProcessInParallel<bool>(
+      m_cached_files.size(),
+      [&](size_t i) {
+        const GameFile& file = *m_cached_files[i];
+        return game_paths.contains(file.GetFilePath()) && file.FileChangedOnDisk();
+      },
+      [&](size_t i, bool changed) { changed_on_disk[i] = changed; }, processing_halted);
+
   // Delete paths that aren't in game_paths from m_cached_files,
   // while simultaneously deleting paths that are in m_cached_files from game_paths.
   // For the sake of speed, we don't care about maintaining the order of m_cached_files.
@@ -113,7 +182,8 @@ bool GameFileCache::Update(
       if (processing_halted)
         break;
 
-      if (game_paths.erase((*it)->GetFilePath()))
+      const size_t index = it - m_cached_files.begin();
+      if (!changed_on_disk[index] && game_paths.erase((*it)->GetFilePath()))
       {
         ++it;
       }
@@ -125,6 +195,7 @@ bool GameFileCache::Update(
         cache_changed = true;
         --end;
         *it = std::move(*end);
+        changed_on_disk[index] = changed_on_disk[end - m_cached_files.begin()];
       }
     }
     m_cached_files.erase(it, m_cached_files.end());
@@ -132,21 +203,21 @@ bool GameFileCache::Update(
 
   // Now that the previous loop has run, game_paths only contains paths that
   // aren't in m_cached_files, so we simply add all of them to m_cached_files.
-  for (const std::string& path : game_paths)
-  {
-    if (processing_halted)
-      break;
+  // Reading the metadata of a file can take a long time, so several files are read at once.
+  const std::vector<std::string> new_paths(game_paths.begin(), game_paths.end());
+  ProcessInParallel<std::shared_ptr<GameFile>>(
+      new_paths.size(), [&](size_t i) { return std::make_shared<GameFile>(new_paths[i]); },
+      [&](size_t, std::shared_ptr<GameFile> file) {
+        if (!file->IsValid())
+          return;
 
-    auto file = std::make_shared<GameFile>(path);
-    if (file->IsValid())
-    {
-      if (game_added_to_cache)
-        game_added_to_cache(file);
+        if (game_added_to_cache)
+          game_added_to_cache(file);
 
-      cache_changed = true;
-      m_cached_files.push_back(std::move(file));
-    }
-  }
+        cache_changed = true;
+        m_cached_files.push_back(std::move(file));
+      },
+      processing_halted);
 
   return cache_changed;
 }
@@ -157,16 +228,16 @@ bool GameFileCache::UpdateAdditionalMetadata(
 {
   bool cache_changed = false;
 
-  for (std::shared_ptr<GameFile>& file : m_cached_files)
-  {
-    if (processing_halted)
-      break;
-
-    const bool updated = UpdateAdditionalMetadata(&file);
-    cache_changed |= updated;
-    if (game_updated && updated)
-      game_updated(file);
-  }
+  // Banners and covers are loaded (and possibly downloaded) on several threads. Each call only
+  // replaces its own element of m_cached_files, so they don't interfere with each other.
+  ProcessInParallel<bool>(
+      m_cached_files.size(), [&](size_t i) { return UpdateAdditionalMetadata(&m_cached_files[i]); },
+      [&](size_t i, bool updated) {
+        cache_changed |= updated;
+        if (game_updated && updated)
+          game_updated(m_cached_files[i]);
+      },
+      processing_halted);
 
   return cache_changed;
 }
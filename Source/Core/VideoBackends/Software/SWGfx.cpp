@@ -8,6 +8,7 @@
 #include "VideoBackends/Software/EfbCopy.h"
 #include "VideoBackends/Software/Rasterizer.h"
 #include "VideoBackends/Software/SWOGLWindow.h"
+#include "VideoBackends/Software/SWSharedMemoryOutput.h"
 #include "VideoBackends/Software/SWTexture.h"
 
 #include "VideoCommon/AbstractPipeline.h"
@@ -22,8 +23,18 @@ SWGfx::SWGfx(std::unique_ptr<SWOGLWindow> window) : m_window(std::move(window))
 {
 }
 
+SWGfx::SWGfx(std::unique_ptr<SWSharedMemoryOutput> shm_output) : m_shm_output(std::move(shm_output))
+{
+}
+
+SWGfx::~SWGfx() = default;
+
 bool SWGfx::IsHeadless() const
 {
+  // Frames written to shared memory are still "presented", just not to a window.
+  if (m_shm_output)
+    return false;
+
   return m_window->IsHeadless();
 }
 
@@ -56,7 +67,7 @@ SWGfx::CreateFramebuffer(AbstractTexture* color_attachment, AbstractTexture* dep
 void SWGfx::BindBackbuffer(const ClearColor& clear_color)
 {
   // Look for framebuffer resizes
-  if (!g_presenter->SurfaceResizedTestAndClear())
+  if (!g_presenter->SurfaceResizedTestAndClear() || !m_window)
     return;
 
   GLContext* context = m_window->GetContext();
@@ -105,7 +116,9 @@ std::unique_ptr<AbstractPipeline> SWGfx::CreatePipeline(const AbstractPipelineCo
 void SWGfx::ShowImage(const AbstractTexture* source_texture,
                       const MathUtil::Rectangle<int>& source_rc)
 {
-  if (!IsHeadless())
+  if (m_shm_output)
+    m_shm_output->WriteFrame(source_texture, source_rc);
+  else if (!IsHeadless())
     m_window->ShowImage(source_texture, source_rc);
 }
 
@@ -132,6 +145,12 @@ void SWGfx::SetScissorRect(const MathUtil::Rectangle<int>& rc)
 
 SurfaceInfo SWGfx::GetSurfaceInfo() const
 {
+  if (m_shm_output)
+  {
+    return {std::max(m_shm_output->GetLastWidth(), 1u),
+            std::max(m_shm_output->GetLastHeight(), 1u), 1.0f, AbstractTextureFormat::RGBA8};
+  }
+
   GLContext* context = m_window->GetContext();
   return {std::max(context->GetBackBufferWidth(), 1u), std::max(context->GetBackBufferHeight(), 1u),
           1.0f, AbstractTextureFormat::RGBA8};
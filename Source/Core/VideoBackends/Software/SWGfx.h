@@ -9,10 +9,14 @@ class SWOGLWindow;
 
 namespace SW
 {
+class SWSharedMemoryOutput;
+
 class SWGfx final : public AbstractGfx
 {
 public:
   SWGfx(std::unique_ptr<SWOGLWindow> window);
+  SWGfx(std::unique_ptr<SWSharedMemoryOutput> shm_output);
+  ~SWGfx() override;
 
   bool IsHeadless() const override;
   virtual bool SupportsUtilityDrawing() const override;
@@ -53,7 +57,10 @@ public:
   SurfaceInfo GetSurfaceInfo() const override;
 
 private:
+  // Exactly one of these is set. The shared memory output replaces the window when frames are
+  // consumed by another process rather than presented.
   std::unique_ptr<SWOGLWindow> m_window;
+  std::unique_ptr<SWSharedMemoryOutput> m_shm_output;
 };
 
 }  // namespace SW
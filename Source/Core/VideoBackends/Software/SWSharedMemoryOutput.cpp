@@ -0,0 +1,194 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoBackends/Software/SWSharedMemoryOutput.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <new>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "Common/Align.h"
+#include "Common/CommonFuncs.h"
+#include "Common/Logging/Log.h"
+#include "Common/MsgHandler.h"
+#include "Common/StringUtil.h"
+
+#include "VideoBackends/Software/SWTexture.h"
+
+namespace SW
+{
+namespace
+{
+constexpr size_t HEADER_SIZE = Common::AlignUp(sizeof(SharedFrameRingHeader), 64);
+constexpr size_t SLOT_HEADER_SIZE = Common::AlignUp(sizeof(SharedFrameSlotHeader), 64);
+constexpr size_t SLOT_SIZE = SLOT_HEADER_SIZE + size_t(SWSharedMemoryOutput::MAX_WIDTH) *
+                                                    SWSharedMemoryOutput::MAX_HEIGHT * 4;
+constexpr size_t TOTAL_SIZE = HEADER_SIZE + SLOT_SIZE * SWSharedMemoryOutput::SLOT_COUNT;
+}  // namespace
+
+SWSharedMemoryOutput::SWSharedMemoryOutput() = default;
+
+SWSharedMemoryOutput::~SWSharedMemoryOutput()
+{
+#ifdef _WIN32
+  if (m_base)
+    UnmapViewOfFile(m_base);
+  if (m_mapping_handle)
+    CloseHandle(m_mapping_handle);
+#elif !defined(__ANDROID__)
+  if (m_base)
+  {
+    munmap(m_base, m_size);
+    shm_unlink(m_name.c_str());
+  }
+#endif
+}
+
+std::unique_ptr<SWSharedMemoryOutput> SWSharedMemoryOutput::Create(const std::string& name)
+{
+  auto output = std::unique_ptr<SWSharedMemoryOutput>(new SWSharedMemoryOutput());
+  if (!output->Initialize(name))
+  {
+    PanicAlertFmt("Failed to create shared memory frame output \"{}\"", name);
+    return nullptr;
+  }
+
+  return output;
+}
+
+bool SWSharedMemoryOutput::Initialize(const std::string& name)
+{
+  m_size = TOTAL_SIZE;
+
+#ifdef _WIN32
+  m_name = name;
+  m_mapping_handle =
+      CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                         static_cast<DWORD>(static_cast<u64>(m_size) >> 32),
+                         static_cast<DWORD>(m_size), UTF8ToWString(m_name).c_str());
+  if (!m_mapping_handle)
+  {
+    ERROR_LOG_FMT(VIDEO, "CreateFileMapping failed: {}", Common::GetLastErrorString());
+    return false;
+  }
+
+  m_base = MapViewOfFile(m_mapping_handle, FILE_MAP_ALL_ACCESS, 0, 0, m_size);
+  if (!m_base)
+  {
+    ERROR_LOG_FMT(VIDEO, "MapViewOfFile failed: {}", Common::GetLastErrorString());
+    return false;
+  }
+#elif !defined(__ANDROID__)
+  m_name = name.starts_with('/') ? name : '/' + name;
+  const int fd = shm_open(m_name.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+  if (fd == -1)
+  {
+    ERROR_LOG_FMT(VIDEO, "shm_open({}) failed: {}", m_name, Common::LastStrerrorString());
+    return false;
+  }
+
+  if (ftruncate(fd, static_cast<off_t>(m_size)) != 0)
+  {
+    ERROR_LOG_FMT(VIDEO, "ftruncate failed: {}", Common::LastStrerrorString());
+    close(fd);
+    shm_unlink(m_name.c_str());
+    return false;
+  }
+
+  void* base = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (base == MAP_FAILED)
+  {
+    ERROR_LOG_FMT(VIDEO, "mmap failed: {}", Common::LastStrerrorString());
+    shm_unlink(m_name.c_str());
+    return false;
+  }
+  m_base = base;
+#else
+  ERROR_LOG_FMT(VIDEO, "Shared memory frame output is not supported on this platform");
+  return false;
+#endif
+
+  SharedFrameRingHeader* header = new (m_base) SharedFrameRingHeader{};
+  header->magic = SharedFrameRingHeader::MAGIC;
+  header->version = SharedFrameRingHeader::VERSION;
+  header->slot_count = SLOT_COUNT;
+  header->slot_size = static_cast<u32>(SLOT_SIZE);
+  header->max_width = MAX_WIDTH;
+  header->max_height = MAX_HEIGHT;
+  for (u32 i = 0; i < SLOT_COUNT; i++)
+    new (GetSlot(i)) SharedFrameSlotHeader{};
+  header->frames_written.store(0, std::memory_order_release);
+
+  INFO_LOG_FMT(VIDEO, "Writing frames to shared memory object {} ({} bytes)", m_name, m_size);
+  return true;
+}
+
+SharedFrameRingHeader* SWSharedMemoryOutput::GetHeader() const
+{
+  return static_cast<SharedFrameRingHeader*>(m_base);
+}
+
+u8* SWSharedMemoryOutput::GetSlot(u32 index) const
+{
+  return static_cast<u8*>(m_base) + HEADER_SIZE + SLOT_SIZE * index;
+}
+
+// Called on the GPU thread
+void SWSharedMemoryOutput::WriteFrame(const AbstractTexture* image,
+                                      const MathUtil::Rectangle<int>& xfb_region)
+{
+  const SWTexture* sw_image = static_cast<const SWTexture*>(image);
+  const u32 image_width = sw_image->GetConfig().width;
+  const u32 image_height = sw_image->GetConfig().height;
+
+  const u32 left = static_cast<u32>(std::clamp<int>(xfb_region.left, 0, image_width));
+  const u32 top = static_cast<u32>(std::clamp<int>(xfb_region.top, 0, image_height));
+  const u32 width = std::min<u32>(static_cast<u32>(std::max(xfb_region.GetWidth(), 0)),
+                                  std::min(image_width - left, MAX_WIDTH));
+  const u32 height = std::min<u32>(static_cast<u32>(std::max(xfb_region.GetHeight(), 0)),
+                                   std::min(image_height - top, MAX_HEIGHT));
+
+  const u64 frame_number = m_frame_number++;
+  u8* const slot = GetSlot(static_cast<u32>(frame_number % SLOT_COUNT));
+  SharedFrameSlotHeader* const slot_header = reinterpret_cast<SharedFrameSlotHeader*>(slot);
+  u8* const dst = slot + SLOT_HEADER_SIZE;
+
+  const u32 seq = slot_header->sequence.load(std::memory_order_relaxed);
+  slot_header->sequence.store(seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  const u32 src_stride = image_width * 4;
+  const u32 dst_stride = width * 4;
+  const u8* src = sw_image->GetData(0, 0) + top * src_stride + left * 4;
+  if (src_stride == dst_stride)
+  {
+    std::memcpy(dst, src, size_t(dst_stride) * height);
+  }
+  else
+  {
+    for (u32 y = 0; y < height; y++)
+      std::memcpy(dst + y * dst_stride, src + y * src_stride, dst_stride);
+  }
+
+  slot_header->width = width;
+  slot_header->height = height;
+  slot_header->stride = dst_stride;
+  slot_header->frame_number = frame_number;
+  slot_header->sequence.store(seq + 2, std::memory_order_release);
+  GetHeader()->frames_written.store(frame_number + 1, std::memory_order_release);
+
+  m_last_width = width;
+  m_last_height = height;
+}
+}  // namespace SW
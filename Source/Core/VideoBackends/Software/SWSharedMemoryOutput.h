@@ -0,0 +1,87 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "Common/CommonTypes.h"
+#include "Common/MathUtil.h"
+
+class AbstractTexture;
+
+namespace SW
+{
+// Layout of the shared memory object written by SWSharedMemoryOutput. External consumers map the
+// object read-only and poll SharedFrameRingHeader::frames_written. Each slot is guarded by a
+// sequence counter: it is odd while the slot is being written and even once the frame is
+// complete, so a reader can detect torn frames by comparing the counter before and after copying.
+struct SharedFrameRingHeader
+{
+  static constexpr u32 MAGIC = 0x4D485344;  // "DSHM"
+  static constexpr u32 VERSION = 1;
+
+  u32 magic;
+  u32 version;
+  u32 slot_count;
+  u32 slot_size;  // Size of each slot, including its SharedFrameSlotHeader
+  u32 max_width;
+  u32 max_height;
+  u32 pad[2];
+  std::atomic<u64> frames_written;
+};
+
+struct SharedFrameSlotHeader
+{
+  std::atomic<u32> sequence;
+  u32 width;
+  u32 height;
+  u32 stride;  // In bytes, pixels are RGBA8
+  u64 frame_number;
+  u64 pad;
+};
+
+static_assert(std::atomic<u64>::is_always_lock_free && std::atomic<u32>::is_always_lock_free,
+              "Shared frame ring atomics must be lock-free to be shared between processes");
+
+// Writes finished XFB frames into a ring buffer in a named shared memory object instead of
+// presenting them, for use with the headless platform.
+class SWSharedMemoryOutput
+{
+public:
+  static constexpr u32 SLOT_COUNT = 4;
+  static constexpr u32 MAX_WIDTH = 1024;
+  static constexpr u32 MAX_HEIGHT = 1024;
+
+  ~SWSharedMemoryOutput();
+
+  u32 GetLastWidth() const { return m_last_width; }
+  u32 GetLastHeight() const { return m_last_height; }
+
+  void WriteFrame(const AbstractTexture* image, const MathUtil::Rectangle<int>& xfb_region);
+
+  static std::unique_ptr<SWSharedMemoryOutput> Create(const std::string& name);
+
+private:
+  SWSharedMemoryOutput();
+
+  bool Initialize(const std::string& name);
+
+  SharedFrameRingHeader* GetHeader() const;
+  u8* GetSlot(u32 index) const;
+
+  std::string m_name;
+  void* m_base = nullptr;
+  size_t m_size = 0;
+#ifdef _WIN32
+  void* m_mapping_handle = nullptr;
+#endif
+
+  u64 m_frame_number = 0;
+  u32 m_last_width = 0;
+  u32 m_last_height = 0;
+};
+}  // namespace SW
@@ -12,6 +12,9 @@
 #include "Common/CommonTypes.h"
 #include "Common/GL/GLContext.h"
 #include "Common/MsgHandler.h"
+#include "Common/WindowSystemInfo.h"
+
+#include "Core/Config/GraphicsSettings.h"
 
 #include "VideoBackends/Software/Clipper.h"
 #include "VideoBackends/Software/EfbInterface.h"
@@ -20,6 +23,7 @@
 #include "VideoBackends/Software/SWGfx.h"
 #include "VideoBackends/Software/SWOGLWindow.h"
 #include "VideoBackends/Software/SWRenderer.h"
+#include "VideoBackends/Software/SWSharedMemoryOutput.h"
 #include "VideoBackends/Software/SWTexture.h"
 #include "VideoBackends/Software/SWVertexLoader.h"
 #include "VideoBackends/Software/TextureCache.h"
@@ -97,16 +101,37 @@ void VideoSoftware::InitBackendInfo(const WindowSystemInfo& wsi)
   g_Config.backend_info.AAModes = {1};
 }
 
-bool VideoSoftware::Initialize(const WindowSystemInfo& wsi)
+static std::unique_ptr<SWGfx> CreateGfx(const WindowSystemInfo& wsi)
 {
+  // When running headless, finished frames can be handed to another process through shared
+  // memory, which avoids creating a GL context at all.
+  const std::string shm_name = Config::Get(Config::GFX_SW_SHARED_MEMORY_OUTPUT);
+  if (wsi.type == WindowSystemType::Headless && !shm_name.empty())
+  {
+    std::unique_ptr<SWSharedMemoryOutput> output = SWSharedMemoryOutput::Create(shm_name);
+    if (!output)
+      return nullptr;
+
+    return std::make_unique<SWGfx>(std::move(output));
+  }
+
   std::unique_ptr<SWOGLWindow> window = SWOGLWindow::Create(wsi);
   if (!window)
+    return nullptr;
+
+  return std::make_unique<SWGfx>(std::move(window));
+}
+
+bool VideoSoftware::Initialize(const WindowSystemInfo& wsi)
+{
+  std::unique_ptr<SWGfx> gfx = CreateGfx(wsi);
+  if (!gfx)
     return false;
 
   Clipper::Init();
   Rasterizer::Init();
 
-  return InitializeShared(std::make_unique<SWGfx>(std::move(window)),
+  return InitializeShared(std::move(gfx),
                           std::make_unique<SWVertexLoader>(), std::make_unique<PerfQuery>(),
                           std::make_unique<SWBoundingBox>(), std::make_unique<SWRenderer>(),
                           std::make_unique<TextureCache>());
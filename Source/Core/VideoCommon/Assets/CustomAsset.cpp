@@ -39,6 +39,11 @@ const CustomAssetLibrary::AssetID& CustomAsset::GetAssetId() const
   return m_asset_id;
 }
 
+std::vector<std::filesystem::path> CustomAsset::GetFilePaths() const
+{
+  return m_owning_library->GetAssetFilePaths(m_asset_id);
+}
+
 std::size_t CustomAsset::GetByteSizeInMemory() const
 {
   std::lock_guard lk(m_info_lock);
@@ -3,8 +3,12 @@
 
 #include "VideoCommon/Assets/CustomAssetLoader.h"
 
+#include <algorithm>
+#include <optional>
+
 #include "Common/Logging/Log.h"
 #include "Common/MemoryUtil.h"
+#include "Common/StringUtil.h"
 #include "VideoCommon/Assets/CustomAssetLibrary.h"
 
 namespace VideoCommon
@@ -28,55 +32,229 @@ void CustomAssetLoader::Init()
         break;
       }
 
-      std::this_thread::sleep_for(TIME_BETWEEN_ASSET_MONITOR_CHECKS);
+      // Without change notifications, the write times of all assets have to be polled
+      if (!m_directory_watcher.IsSupported())
+      {
+        std::this_thread::sleep_for(TIME_BETWEEN_ASSET_MONITOR_CHECKS);
+        ReloadChangedAssets(nullptr);
+        continue;
+      }
 
-      std::lock_guard lk(m_asset_load_lock);
-      for (auto& [asset_id, asset_to_monitor] : m_assets_to_monitor)
+      // The assets in directories which couldn't be watched are polled instead
+      std::set<std::filesystem::path> changed_directories;
       {
-        if (auto ptr = asset_to_monitor.lock())
-        {
-          const auto write_time = ptr->GetLastWriteTime();
-          if (write_time > ptr->GetLastLoadedTime())
-          {
-            (void)ptr->Load();
-          }
-        }
+        std::lock_guard lk(m_asset_load_lock);
+        changed_directories = m_unwatched_directories;
       }
-    }
-  });
 
-  m_asset_load_thread.Reset("Custom Asset Loader", [this](std::weak_ptr<CustomAsset> asset) {
-    if (auto ptr = asset.lock())
-    {
-      if (ptr->Load())
+      const auto changes = m_directory_watcher.Wait(
+          changed_directories.empty() ?
+              std::nullopt :
+              std::optional<std::chrono::milliseconds>(TIME_BETWEEN_ASSET_MONITOR_CHECKS));
+      if (changes.overflowed)
+      {
+        ReloadChangedAssets(nullptr);
+        continue;
+      }
+
+      for (const std::string& path : changes.paths)
+        changed_directories.insert(StringToPath(path).parent_path());
+      for (const std::string& directory : changes.directories)
+        changed_directories.insert(StringToPath(directory));
+      if (!changes.unwatched_directories.empty())
       {
         std::lock_guard lk(m_asset_load_lock);
-        const std::size_t asset_memory_size = ptr->GetByteSizeInMemory();
-        if (m_max_memory_available >= m_total_bytes_loaded + asset_memory_size)
+        for (const std::string& directory : changes.unwatched_directories)
         {
-          m_total_bytes_loaded += asset_memory_size;
-          m_assets_to_monitor.try_emplace(ptr->GetAssetId(), ptr);
-        }
-        else
-        {
-          ERROR_LOG_FMT(VIDEO, "Failed to load asset {} because there was not enough memory.",
-                        ptr->GetAssetId());
+          WARN_LOG_FMT(VIDEO, "Stopped watching {} for changes, polling it instead", directory);
+          m_unwatched_directories.insert(StringToPath(directory));
         }
       }
+      if (!changed_directories.empty())
+        ReloadChangedAssets(&changed_directories);
     }
   });
+
+  // Loading is mostly bound by decoding the images, so use a few threads
+  const u32 num_threads = std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u);
+  m_asset_load_pool.Reset("Custom Asset Loader", num_threads);
+  m_asset_prefetch_pool.Reset("Custom Asset Prefetcher", num_threads);
 }
 
 void CustomAssetLoader ::Shutdown()
 {
-  m_asset_load_thread.Shutdown(true);
+  m_asset_prefetch_pool.Shutdown(true);
+  m_asset_load_pool.Shutdown(true);
 
   m_asset_monitor_thread_shutdown.Set();
+  m_directory_watcher.Interrupt();
   m_asset_monitor_thread.join();
+
+  std::lock_guard lk(m_asset_load_lock);
+  m_prefetched_assets.clear();
+  m_failed_loads.clear();
+  m_unwatched_directories.clear();
   m_assets_to_monitor.clear();
   m_total_bytes_loaded = 0;
 }
 
+void CustomAssetLoader::QueueLoad(std::weak_ptr<CustomAsset> asset, bool prefetch)
+{
+  if (!prefetch)
+  {
+    m_asset_load_pool.Push([this, asset = std::move(asset)] { LoadAsset(asset); });
+    return;
+  }
+
+  m_asset_prefetch_pool.Push([this, asset = std::move(asset)] {
+    // Requested assets always go first
+    m_asset_load_pool.WaitForCompletion();
+    if (!m_asset_prefetch_pool.IsCancelling())
+      LoadAsset(asset);
+  });
+}
+
+void CustomAssetLoader::LoadAsset(const std::weak_ptr<CustomAsset>& asset)
+{
+  auto ptr = asset.lock();
+  if (!ptr)
+    return;
+
+  const CustomAssetLibrary::AssetID& asset_id = ptr->GetAssetId();
+  std::optional<CustomAssetLibrary::TimeType> failed_write_time;
+  {
+    std::lock_guard lk(m_asset_load_lock);
+    if (m_assets_to_monitor.contains(asset_id) || !m_assets_loading.insert(asset_id).second)
+      return;
+
+    if (const auto iter = m_failed_loads.find(asset_id); iter != m_failed_loads.end())
+      failed_write_time = iter->second;
+  }
+
+  // Don't try to load an asset again which failed to load, unless its files have changed since.
+  // The write time is read before loading, so that writes during the load aren't missed.
+  const CustomAssetLibrary::TimeType write_time = ptr->GetLastWriteTime();
+  const bool loaded = write_time != failed_write_time && ptr->Load();
+
+  std::lock_guard lk(m_asset_load_lock);
+  m_assets_loading.erase(asset_id);
+  if (!loaded)
+  {
+    m_failed_loads.insert_or_assign(asset_id, write_time);
+    return;
+  }
+  m_failed_loads.erase(asset_id);
+
+  // Prefetched assets make room for the ones which are actually needed
+  const bool prefetched = m_prefetched_assets.contains(asset_id);
+  const std::size_t asset_memory_size = ptr->GetByteSizeInMemory();
+  if (!prefetched)
+    EvictPrefetchedAssets(asset_memory_size);
+
+  if (m_max_memory_available >= m_total_bytes_loaded + asset_memory_size)
+  {
+    if (m_assets_to_monitor.try_emplace(asset_id, MonitoredAsset{ptr, asset_memory_size}).second)
+      m_total_bytes_loaded += asset_memory_size;
+    WatchAssetFiles(*ptr);
+  }
+  else if (prefetched)
+  {
+    // Not needed yet, so the memory of this asset is better freed right away
+    INFO_LOG_FMT(VIDEO, "Dropped prefetched asset {} because there was not enough memory.",
+                 asset_id);
+    m_prefetched_assets.erase(asset_id);
+  }
+  else
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to load asset {} because there was not enough memory.",
+                  asset_id);
+  }
+}
+
+void CustomAssetLoader::WatchAssetFiles(const CustomAsset& asset)
+{
+  for (const std::filesystem::path& path : asset.GetFilePaths())
+  {
+    const std::filesystem::path directory = path.parent_path();
+    if (m_directory_watcher.AddDirectory(PathToString(directory)) ||
+        !m_directory_watcher.IsSupported() || !m_unwatched_directories.insert(directory).second)
+    {
+      continue;
+    }
+
+    // Make the monitor thread start polling the directory
+    WARN_LOG_FMT(VIDEO, "Failed to watch {} for changes, polling it instead",
+                 PathToString(directory));
+    m_directory_watcher.Interrupt();
+  }
+}
+
+void CustomAssetLoader::AddPrefetchedAsset(std::shared_ptr<CustomAsset> asset)
+{
+  std::lock_guard lk(m_asset_load_lock);
+  const CustomAssetLibrary::AssetID asset_id = asset->GetAssetId();
+  m_prefetched_assets.insert_or_assign(asset_id,
+                                       PrefetchedAsset{std::move(asset), m_prefetch_count++});
+}
+
+bool CustomAssetLoader::PromotePrefetchedAsset(const CustomAssetLibrary::AssetID& asset_id)
+{
+  // From now on, the asset is only kept alive by the ones which requested it
+  std::lock_guard lk(m_asset_load_lock);
+  return m_prefetched_assets.erase(asset_id) != 0;
+}
+
+void CustomAssetLoader::EvictPrefetchedAssets(std::size_t bytes_needed)
+{
+  // The prefetch order is the order the assets were needed in last time, so the ones prefetched
+  // last are likely needed last
+  while (m_max_memory_available < m_total_bytes_loaded + bytes_needed &&
+         !m_prefetched_assets.empty())
+  {
+    const auto iter = std::max_element(
+        m_prefetched_assets.begin(), m_prefetched_assets.end(),
+        [](const auto& a, const auto& b) { return a.second.order < b.second.order; });
+
+    // Unless someone else still holds on to the asset, this frees it, which updates
+    // m_total_bytes_loaded
+    m_prefetched_assets.erase(iter);
+  }
+}
+
+void CustomAssetLoader::ReleasePrefetchedAssets()
+{
+  std::lock_guard lk(m_asset_load_lock);
+  m_prefetched_assets.clear();
+}
+
+void CustomAssetLoader::ReloadChangedAssets(
+    const std::set<std::filesystem::path>* changed_directories)
+{
+  std::lock_guard lk(m_asset_load_lock);
+  for (auto& [asset_id, asset_to_monitor] : m_assets_to_monitor)
+  {
+    auto ptr = asset_to_monitor.asset.lock();
+    if (!ptr)
+      continue;
+
+    if (changed_directories)
+    {
+      const auto paths = ptr->GetFilePaths();
+      const bool affected = paths.empty() || std::any_of(paths.begin(), paths.end(), [&](auto& p) {
+                              return changed_directories->contains(p.parent_path());
+                            });
+      if (!affected)
+        continue;
+    }
+
+    const auto write_time = ptr->GetLastWriteTime();
+    if (write_time > ptr->GetLastLoadedTime())
+    {
+      (void)ptr->Load();
+    }
+  }
+}
+
 std::shared_ptr<RawTextureAsset>
 CustomAssetLoader::LoadTexture(const CustomAssetLibrary::AssetID& asset_id,
                                std::shared_ptr<CustomAssetLibrary> library)
@@ -91,6 +269,13 @@ CustomAssetLoader::LoadGameTexture(const CustomAssetLibrary::AssetID& asset_id,
   return LoadOrCreateAsset<GameTextureAsset>(asset_id, m_game_textures, std::move(library));
 }
 
+std::shared_ptr<GameTextureAsset>
+CustomAssetLoader::PrefetchGameTexture(const CustomAssetLibrary::AssetID& asset_id,
+                                       std::shared_ptr<CustomAssetLibrary> library)
+{
+  return LoadOrCreateAsset<GameTextureAsset>(asset_id, m_game_textures, std::move(library), true);
+}
+
 std::shared_ptr<PixelShaderAsset>
 CustomAssetLoader::LoadPixelShader(const CustomAssetLibrary::AssetID& asset_id,
                                    std::shared_ptr<CustomAssetLibrary> library)
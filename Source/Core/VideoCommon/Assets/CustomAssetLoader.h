@@ -7,10 +7,12 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <thread>
 
+#include "Common/DirectoryWatcher.h"
 #include "Common/Flag.h"
-#include "Common/WorkQueueThread.h"
+#include "Common/ThreadPool.h"
 #include "VideoCommon/Assets/CustomAsset.h"
 #include "VideoCommon/Assets/MaterialAsset.h"
 #include "VideoCommon/Assets/ShaderAsset.h"
@@ -20,6 +22,9 @@ namespace VideoCommon
 {
 // This class is responsible for loading data asynchronously when requested
 // and watches that data asynchronously reloading it if it changes
+// Requested assets are loaded on several threads, ahead of any prefetched assets
+// Prefetched assets are kept alive by the loader until they are requested, and are the first
+// to be released when the memory for assets runs out
 class CustomAssetLoader
 {
 public:
@@ -50,34 +55,73 @@ public:
   std::shared_ptr<MaterialAsset> LoadMaterial(const CustomAssetLibrary::AssetID& asset_id,
                                               std::shared_ptr<CustomAssetLibrary> library);
 
+  // Same as 'LoadGameTexture' but the load waits until no requested assets are queued
+  // Used to warm up textures which are expected to be needed soon
+  std::shared_ptr<GameTextureAsset>
+  PrefetchGameTexture(const CustomAssetLibrary::AssetID& asset_id,
+                      std::shared_ptr<CustomAssetLibrary> library);
+
+  // Stops keeping the prefetched assets which haven't been requested yet alive
+  void ReleasePrefetchedAssets();
+
 private:
   // TODO C++20: use a 'derived_from' concept against 'CustomAsset' when available
   template <typename AssetType>
   std::shared_ptr<AssetType>
   LoadOrCreateAsset(const CustomAssetLibrary::AssetID& asset_id,
                     std::map<CustomAssetLibrary::AssetID, std::weak_ptr<AssetType>>& asset_map,
-                    std::shared_ptr<CustomAssetLibrary> library)
+                    std::shared_ptr<CustomAssetLibrary> library, bool prefetch = false)
   {
     auto [it, inserted] = asset_map.try_emplace(asset_id);
     if (!inserted)
     {
       auto shared = it->second.lock();
       if (shared)
+      {
+        // A prefetched asset which is requested before it was loaded jumps the queue
+        if (!prefetch && PromotePrefetchedAsset(asset_id) &&
+            shared->GetLastLoadedTime() == CustomAssetLibrary::TimeType{})
+        {
+          QueueLoad(shared, false);
+        }
         return shared;
+      }
     }
     std::shared_ptr<AssetType> ptr(new AssetType(std::move(library), asset_id), [&](AssetType* a) {
       {
         std::lock_guard lk(m_asset_load_lock);
-        m_total_bytes_loaded -= a->GetByteSizeInMemory();
-        m_assets_to_monitor.erase(a->GetAssetId());
+        // Only assets which were loaded within the memory limit count towards it
+        const auto iter = m_assets_to_monitor.find(a->GetAssetId());
+        if (iter != m_assets_to_monitor.end())
+        {
+          m_total_bytes_loaded -= iter->second.byte_size;
+          m_assets_to_monitor.erase(iter);
+        }
       }
       delete a;
     });
     it->second = ptr;
-    m_asset_load_thread.Push(it->second);
+    if (prefetch)
+      AddPrefetchedAsset(ptr);
+    QueueLoad(ptr, prefetch);
     return ptr;
   }
 
+  void QueueLoad(std::weak_ptr<CustomAsset> asset, bool prefetch);
+  void LoadAsset(const std::weak_ptr<CustomAsset>& asset);
+
+  void AddPrefetchedAsset(std::shared_ptr<CustomAsset> asset);
+  // Returns true if the asset was prefetched and not requested before
+  bool PromotePrefetchedAsset(const CustomAssetLibrary::AssetID& asset_id);
+  // Releases the prefetched assets which would be needed last, until there is enough memory for
+  // the given number of bytes or none are left
+  void EvictPrefetchedAssets(std::size_t bytes_needed);
+  void WatchAssetFiles(const CustomAsset& asset);
+
+  // Reloads the monitored assets which changed on disk
+  // If 'changed_directories' is set, only assets with files in those directories are checked
+  void ReloadChangedAssets(const std::set<std::filesystem::path>* changed_directories);
+
   static constexpr auto TIME_BETWEEN_ASSET_MONITOR_CHECKS = std::chrono::milliseconds{500};
 
   std::map<CustomAssetLibrary::AssetID, std::weak_ptr<RawTextureAsset>> m_textures;
@@ -86,15 +130,43 @@ private:
   std::map<CustomAssetLibrary::AssetID, std::weak_ptr<MaterialAsset>> m_materials;
   std::thread m_asset_monitor_thread;
   Common::Flag m_asset_monitor_thread_shutdown;
+  Common::DirectoryWatcher m_directory_watcher;
 
   std::size_t m_total_bytes_loaded = 0;
   std::size_t m_max_memory_available = 0;
 
-  std::map<CustomAssetLibrary::AssetID, std::weak_ptr<CustomAsset>> m_assets_to_monitor;
+  // Loaded assets, with the number of bytes they were counted with in 'm_total_bytes_loaded'
+  struct MonitoredAsset
+  {
+    std::weak_ptr<CustomAsset> asset;
+    std::size_t byte_size;
+  };
+  std::map<CustomAssetLibrary::AssetID, MonitoredAsset> m_assets_to_monitor;
+
+  // Prefetched assets which haven't been requested yet, with the order they were prefetched in
+  struct PrefetchedAsset
+  {
+    std::shared_ptr<CustomAsset> asset;
+    u64 order;
+  };
+  std::map<CustomAssetLibrary::AssetID, PrefetchedAsset> m_prefetched_assets;
+  u64 m_prefetch_count = 0;
+
+  // Assets which failed to load, with the write time of their files at the time
+  // They are only loaded again once their files have been written to
+  std::map<CustomAssetLibrary::AssetID, CustomAssetLibrary::TimeType> m_failed_loads;
+
+  // Directories of monitored assets which couldn't be watched for changes, which are polled
+  std::set<std::filesystem::path> m_unwatched_directories;
+
+  // Assets currently being loaded, so that an asset queued both as a prefetch
+  // and as a request is only loaded once
+  std::set<CustomAssetLibrary::AssetID> m_assets_loading;
 
   // Use a recursive mutex to handle the scenario where an asset goes out of scope while
   // iterating over the assets to monitor which calls the lock above in 'LoadOrCreateAsset'
   std::recursive_mutex m_asset_load_lock;
-  Common::WorkQueueThread<std::weak_ptr<CustomAsset>> m_asset_load_thread;
+  Common::ThreadPool m_asset_load_pool;
+  Common::ThreadPool m_asset_prefetch_pool;
 };
 }  // namespace VideoCommon
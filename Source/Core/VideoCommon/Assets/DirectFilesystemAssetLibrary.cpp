@@ -68,6 +68,15 @@ DirectFilesystemAssetLibrary::GetLastAssetWriteTime(const AssetID& asset_id) con
   return {};
 }
 
+std::vector<std::filesystem::path>
+DirectFilesystemAssetLibrary::GetAssetFilePaths(const AssetID& asset_id) const
+{
+  std::vector<std::filesystem::path> paths;
+  for (auto& [key, value] : GetAssetMapForID(asset_id))
+    paths.push_back(std::move(value));
+  return paths;
+}
+
 CustomAssetLibrary::LoadInfo DirectFilesystemAssetLibrary::LoadPixelShader(const AssetID& asset_id,
                                                                            PixelShaderData* data)
 {
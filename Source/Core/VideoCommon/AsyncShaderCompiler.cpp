@@ -34,9 +34,22 @@ void AsyncShaderCompiler::QueueWorkItem(WorkItemPtr item, u32 priority)
   }
   else
   {
-    std::lock_guard<std::mutex> guard(m_pending_work_lock);
-    m_pending_work.emplace(priority, std::move(item));
-    m_worker_thread_wake.notify_one();
+    const size_t queue_index = m_next_queue.fetch_add(1) % m_worker_threads.size();
+    WorkQueue& queue = *m_work_queues[queue_index];
+    {
+      // Count the item before a worker can pop it, as the worker decrements the count.
+      std::lock_guard<std::mutex> guard(queue.lock);
+      m_pending_items++;
+      queue.buckets[priority].push_back(std::move(item));
+      queue.next_priority.store(queue.buckets.begin()->first);
+    }
+
+    // Only wake a worker if one is waiting for work.
+    if (m_sleeping_workers.load() != 0)
+    {
+      std::lock_guard<std::mutex> guard(m_worker_thread_wake_lock);
+      m_worker_thread_wake.notify_one();
+    }
   }
 }
 
@@ -57,8 +70,8 @@ void AsyncShaderCompiler::RetrieveWorkItems()
 
 bool AsyncShaderCompiler::HasPendingWork()
 {
-  std::lock_guard<std::mutex> guard(m_pending_work_lock);
-  return !m_pending_work.empty() || m_busy_workers.load() != 0;
+  // Items are counted as busy before they stop being pending, so this can't miss any.
+  return m_pending_items.load() != 0 || m_busy_workers.load() != 0;
 }
 
 bool AsyncShaderCompiler::HasCompletedWork()
@@ -87,10 +100,8 @@ bool AsyncShaderCompiler::WaitUntilCompletion(
   // Grab the number of pending items. We use this to work out how many are left.
   size_t total_items;
   {
-    // Safe to hold both locks here, since nowhere else does.
-    std::lock_guard<std::mutex> pending_guard(m_pending_work_lock);
     std::lock_guard<std::mutex> completed_guard(m_completed_work_lock);
-    total_items = m_completed_work.size() + m_pending_work.size() + m_busy_workers.load() + 1;
+    total_items = m_completed_work.size() + m_pending_items.load() + m_busy_workers.load() + 1;
   }
 
   // Update progress while the compiles complete.
@@ -99,13 +110,9 @@ bool AsyncShaderCompiler::WaitUntilCompletion(
     if (Core::GetState() == Core::State::Stopping)
       return false;
 
-    size_t remaining_items;
-    {
-      std::lock_guard<std::mutex> pending_guard(m_pending_work_lock);
-      if (m_pending_work.empty() && !m_busy_workers.load())
-        break;
-      remaining_items = m_pending_work.size();
-    }
+    const size_t remaining_items = m_pending_items.load();
+    if (remaining_items == 0 && !m_busy_workers.load())
+      break;
 
     progress_callback(total_items - remaining_items, total_items);
     std::this_thread::sleep_for(CHECK_INTERVAL);
@@ -118,6 +125,10 @@ bool AsyncShaderCompiler::StartWorkerThreads(u32 num_worker_threads)
   if (num_worker_threads == 0)
     return true;
 
+  // Work which was left in the queues of earlier workers is picked up by the new ones.
+  while (m_work_queues.size() < num_worker_threads)
+    m_work_queues.push_back(std::make_unique<WorkQueue>());
+
   for (u32 i = 0; i < num_worker_threads; i++)
   {
     void* thread_param = nullptr;
@@ -129,7 +140,8 @@ bool AsyncShaderCompiler::StartWorkerThreads(u32 num_worker_threads)
 
     m_worker_thread_start_result.store(false);
 
-    std::thread thr(&AsyncShaderCompiler::WorkerThreadEntryPoint, this, thread_param);
+    std::thread thr(&AsyncShaderCompiler::WorkerThreadEntryPoint, this, thread_param,
+                    m_worker_threads.size());
     m_init_event.Wait();
 
     if (!m_worker_thread_start_result.load())
@@ -166,7 +178,7 @@ void AsyncShaderCompiler::StopWorkerThreads()
 
   // Signal worker threads to stop, and wake all of them.
   {
-    std::lock_guard<std::mutex> guard(m_pending_work_lock);
+    std::lock_guard<std::mutex> guard(m_worker_thread_wake_lock);
     m_exit_flag.Set();
     m_worker_thread_wake.notify_all();
   }
@@ -192,7 +204,7 @@ void AsyncShaderCompiler::WorkerThreadExit(void* param)
 {
 }
 
-void AsyncShaderCompiler::WorkerThreadEntryPoint(void* param)
+void AsyncShaderCompiler::WorkerThreadEntryPoint(void* param, size_t index)
 {
   Common::SetCurrentThreadName("AsyncShaderCompiler Worker");
 
@@ -208,36 +220,78 @@ void AsyncShaderCompiler::WorkerThreadEntryPoint(void* param)
   m_worker_thread_start_result.store(true);
   m_init_event.Set();
 
-  WorkerThreadRun();
+  WorkerThreadRun(index);
 
   WorkerThreadExit(param);
 }
 
-void AsyncShaderCompiler::WorkerThreadRun()
+void AsyncShaderCompiler::WorkerThreadRun(size_t index)
 {
-  std::unique_lock<std::mutex> pending_lock(m_pending_work_lock);
   while (!m_exit_flag.IsSet())
   {
-    m_worker_thread_wake.wait(pending_lock);
+    WorkItemPtr item = PopWorkItem(index);
+    if (!item)
+    {
+      std::unique_lock<std::mutex> wake_lock(m_worker_thread_wake_lock);
+      m_sleeping_workers++;
+      m_worker_thread_wake.wait(
+          wake_lock, [&] { return m_pending_items.load() != 0 || m_exit_flag.IsSet(); });
+      m_sleeping_workers--;
+      continue;
+    }
 
-    while (!m_pending_work.empty() && !m_exit_flag.IsSet())
+    if (item->Compile())
     {
-      m_busy_workers++;
-      auto iter = m_pending_work.begin();
-      WorkItemPtr item(std::move(iter->second));
-      m_pending_work.erase(iter);
-      pending_lock.unlock();
+      std::lock_guard<std::mutex> completed_guard(m_completed_work_lock);
+      m_completed_work.push_back(std::move(item));
+    }
+
+    m_busy_workers--;
+  }
+}
 
-      if (item->Compile())
+AsyncShaderCompiler::WorkItemPtr AsyncShaderCompiler::PopWorkItem(size_t index)
+{
+  const size_t num_queues = m_work_queues.size();
+  while (m_pending_items.load() != 0)
+  {
+    // Look for the most urgent item, starting with this worker's own queue so it wins ties.
+    WorkQueue* best_queue = nullptr;
+    u32 best_priority = WorkQueue::EMPTY;
+    for (size_t i = 0; i < num_queues; i++)
+    {
+      WorkQueue& queue = *m_work_queues[(index + i) % num_queues];
+      const u32 priority = queue.next_priority.load();
+      if (priority < best_priority)
       {
-        std::lock_guard<std::mutex> completed_guard(m_completed_work_lock);
-        m_completed_work.push_back(std::move(item));
+        best_queue = &queue;
+        best_priority = priority;
       }
-
-      pending_lock.lock();
-      m_busy_workers--;
     }
+    if (!best_queue)
+      return nullptr;
+
+    std::lock_guard<std::mutex> guard(best_queue->lock);
+
+    // Another worker may have emptied the queue in the meantime.
+    if (best_queue->buckets.empty())
+      continue;
+
+    auto bucket = best_queue->buckets.begin();
+    WorkItemPtr item = std::move(bucket->second.front());
+    bucket->second.pop_front();
+    if (bucket->second.empty())
+      best_queue->buckets.erase(bucket);
+    best_queue->next_priority.store(best_queue->buckets.empty() ?
+                                        WorkQueue::EMPTY :
+                                        best_queue->buckets.begin()->first);
+
+    m_busy_workers++;
+    m_pending_items--;
+    return item;
   }
+
+  return nullptr;
 }
 
 }  // namespace VideoCommon
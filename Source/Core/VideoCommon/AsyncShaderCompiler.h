@@ -7,6 +7,7 @@
 #include <condition_variable>
 #include <deque>
 #include <functional>
+#include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -65,8 +66,23 @@ protected:
   virtual void WorkerThreadExit(void* param);
 
 private:
-  void WorkerThreadEntryPoint(void* param);
-  void WorkerThreadRun();
+  // Pending work items are spread over one queue per worker thread, so that queueing and picking
+  // up items rarely contend on the same lock. Workers take the most urgent item of all queues,
+  // preferring their own queue.
+  struct WorkQueue
+  {
+    static constexpr u32 EMPTY = std::numeric_limits<u32>::max();
+
+    std::mutex lock;
+    // Work items of each priority, in the order they were queued.
+    std::map<u32, std::deque<WorkItemPtr>> buckets;
+    // Priority of the most urgent item, so workers can pick a queue without locking all of them.
+    std::atomic<u32> next_priority{EMPTY};
+  };
+
+  void WorkerThreadEntryPoint(void* param, size_t index);
+  void WorkerThreadRun(size_t index);
+  WorkItemPtr PopWorkItem(size_t index);
 
   Common::Flag m_exit_flag;
   Common::Event m_init_event;
@@ -74,13 +90,16 @@ private:
   std::vector<std::thread> m_worker_threads;
   std::atomic_bool m_worker_thread_start_result{false};
 
-  // A multimap is used to store the work items. We can't use a priority_queue here, because
-  // there's no way to obtain a non-const reference, which we need for the unique_ptr.
-  std::multimap<u32, WorkItemPtr> m_pending_work;
-  std::mutex m_pending_work_lock;
-  std::condition_variable m_worker_thread_wake;
+  // Only grows, and only while there are no worker threads.
+  std::vector<std::unique_ptr<WorkQueue>> m_work_queues;
+  std::atomic_size_t m_next_queue{0};
+  std::atomic_size_t m_pending_items{0};
   std::atomic_size_t m_busy_workers{0};
 
+  std::mutex m_worker_thread_wake_lock;
+  std::condition_variable m_worker_thread_wake;
+  std::atomic_size_t m_sleeping_workers{0};
+
   std::deque<WorkItemPtr> m_completed_work;
   std::mutex m_completed_work_lock;
 };
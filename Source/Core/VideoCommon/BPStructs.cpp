@@ -185,7 +185,7 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager,
     case 0x02:
     {
       INCSTAT(g_stats.this_frame.num_draw_done);
-      g_texture_cache->FlushEFBCopies();
+      g_texture_cache->FlushDueEFBCopies();
       g_texture_cache->FlushStaleBinds();
       g_framebuffer_manager->InvalidatePeekCache(false);
       g_framebuffer_manager->RefreshPeekCache();
@@ -204,7 +204,7 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager,
   case BPMEM_PE_TOKEN_ID:  // Pixel Engine Token ID
   {
     INCSTAT(g_stats.this_frame.num_token);
-    g_texture_cache->FlushEFBCopies();
+    g_texture_cache->FlushDueEFBCopies();
     g_texture_cache->FlushStaleBinds();
     g_framebuffer_manager->InvalidatePeekCache(false);
     g_framebuffer_manager->RefreshPeekCache();
@@ -220,7 +220,7 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager,
   case BPMEM_PE_TOKEN_INT_ID:  // Pixel Engine Interrupt Token ID
   {
     INCSTAT(g_stats.this_frame.num_token_int);
-    g_texture_cache->FlushEFBCopies();
+    g_texture_cache->FlushDueEFBCopies();
     g_texture_cache->FlushStaleBinds();
     g_framebuffer_manager->InvalidatePeekCache(false);
     g_framebuffer_manager->RefreshPeekCache();
@@ -392,6 +392,9 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager,
     if (!SConfig::GetInstance().bWii)
       addr = addr & 0x01FFFFFF;
 
+    // Pending EFB copies to the palette have to be in RAM before it's loaded into TMEM.
+    g_texture_cache->FlushEFBCopiesForRead(addr, tlutXferCount, 0, 0);
+
     auto& system = Core::System::GetInstance();
     auto& memory = system.GetMemory();
     memory.CopyFromEmu(texMem + tlutTMemAddr, addr, tlutXferCount);
@@ -586,12 +589,18 @@ static void BPWritten(PixelShaderManager& pixel_shader_manager,
         if (tmem_addr_even + bytes_read > TMEM_SIZE)
           bytes_read = TMEM_SIZE - tmem_addr_even;
 
+        // As with TLUT loads, pending EFB copies to the source have to be in RAM first.
+        g_texture_cache->FlushEFBCopiesForRead(src_addr, bytes_read, 0, 0);
+
         auto& system = Core::System::GetInstance();
         auto& memory = system.GetMemory();
         memory.CopyFromEmu(texMem + tmem_addr_even, src_addr, bytes_read);
       }
       else  // RGBA8 tiles (and CI14, but that might just be stupid libogc!)
       {
+        g_texture_cache->FlushEFBCopiesForRead(
+            src_addr, tmem_cfg.preload_tile_info.count * TMEM_LINE_SIZE * 2, 0, 0);
+
         auto& system = Core::System::GetInstance();
         auto& memory = system.GetMemory();
         u8* src_ptr = memory.GetPointer(src_addr);
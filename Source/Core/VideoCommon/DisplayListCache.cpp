@@ -0,0 +1,43 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/DisplayListCache.h"
+
+DisplayListCache::Entry& DisplayListCache::GetEntry(u32 address, u32 size, u64 write_generation)
+{
+  if (m_entries.size() >= MAX_ENTRIES)
+    Clear();
+
+  const u64 key = static_cast<u64>(address) << 32 | size;
+  const auto [iter, inserted] = m_entries.try_emplace(key);
+  Entry& entry = iter->second;
+  entry.last_used_frame = m_frame;
+
+  if (!inserted && entry.write_generation != write_generation)
+  {
+    entry.commands.clear();
+    entry.decoded = false;
+  }
+  entry.write_generation = write_generation;
+  return entry;
+}
+
+void DisplayListCache::Clear()
+{
+  m_entries.clear();
+}
+
+void DisplayListCache::OnFrameEnd()
+{
+  m_frame++;
+  if (m_frame % FRAMES_TO_KEEP != 0)
+    return;
+
+  for (auto iter = m_entries.begin(); iter != m_entries.end();)
+  {
+    if (m_frame - iter->second.last_used_frame > FRAMES_TO_KEEP)
+      iter = m_entries.erase(iter);
+    else
+      ++iter;
+  }
+}
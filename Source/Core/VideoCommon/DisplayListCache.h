@@ -0,0 +1,269 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/HookableEvent.h"
+
+#include "VideoCommon/CPMemory.h"
+#include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/VideoEvents.h"
+
+// Keeps the commands of display lists which have already been run in decoded form, so that lists
+// called again with unchanged contents are replayed without parsing the command bytes again.
+// Lists are identified by their address and size, and are checked for modifications with the
+// write tracking of the memory manager. Without it, every call would have to hash the whole list,
+// which costs about as much as parsing it, so the cache must only be used while CPU writes are
+// tracked.
+//
+// The size of the vertices of a primitive command depends on the vertex format at the time the
+// list is called, so it is checked again on every replay and the rest of the list is decoded
+// from scratch if it doesn't match anymore.
+class DisplayListCache
+{
+public:
+  static constexpr size_t MAX_ENTRIES = 16384;
+  static constexpr u64 FRAMES_TO_KEEP = 60;
+
+  // Runs the display list with the given callback, replaying it from the cache if possible.
+  // write_generation is the write generation of the list's memory range, see
+  // MemoryManager::GetRangeWriteGeneration. Returns the number of bytes which were processed, like
+  // OpcodeDecoder::Run.
+  template <typename T>
+  u32 Run(u32 address, u32 size, const u8* data, u64 write_generation, T& callback);
+
+  void Clear();
+
+private:
+  struct Command
+  {
+    enum class Type : u8
+    {
+      Nop,
+      CP,
+      XF,
+      BP,
+      IndexedLoad,
+      Primitive,
+      DisplayList,
+      Unknown,
+    };
+
+    Type type;
+    union
+    {
+      struct
+      {
+        u32 count;
+      } nop;
+      // Used for both CP and BP commands.
+      struct
+      {
+        u8 command;
+        u32 value;
+      } reg;
+      // The data follows the 5 byte header of the command.
+      struct
+      {
+        u16 address;
+        u8 count;
+      } xf;
+      struct
+      {
+        CPArray array;
+        u8 size;
+        u16 address;
+        u32 index;
+      } indexed_load;
+      // The vertices follow the 3 byte header of the command.
+      struct
+      {
+        OpcodeDecoder::Primitive primitive;
+        u8 vat;
+        u16 num_vertices;
+        u32 vertex_size;
+      } primitive;
+      struct
+      {
+        u32 address;
+        u32 size;
+      } display_list;
+    };
+
+    // Location of the command bytes in the display list.
+    u32 offset;
+    u32 size;
+  };
+
+  struct Entry
+  {
+    std::vector<Command> commands;
+    // Number of bytes covered by the commands.
+    u32 decoded_size = 0;
+    bool decoded = false;
+    u64 write_generation = 0;
+    u64 last_used_frame = 0;
+  };
+
+  // Records the commands of a display list as they are passed to the actual callback.
+  template <typename T>
+  class Recorder final : public OpcodeDecoder::Callback
+  {
+  public:
+    Recorder(const u8* start, std::vector<Command>& commands, T& callback)
+        : m_start(start), m_commands(commands), m_callback(callback)
+    {
+    }
+
+    OPCODE_CALLBACK(void OnXF(u16 address, u8 count, const u8* data))
+    {
+      Push(Command::Type::XF).xf = {address, count};
+      m_callback.OnXF(address, count, data);
+    }
+    OPCODE_CALLBACK(void OnCP(u8 command, u32 value))
+    {
+      Push(Command::Type::CP).reg = {command, value};
+      m_callback.OnCP(command, value);
+    }
+    OPCODE_CALLBACK(void OnBP(u8 command, u32 value))
+    {
+      Push(Command::Type::BP).reg = {command, value};
+      m_callback.OnBP(command, value);
+    }
+    OPCODE_CALLBACK(void OnIndexedLoad(CPArray array, u32 index, u16 address, u8 size))
+    {
+      Push(Command::Type::IndexedLoad).indexed_load = {array, size, address, index};
+      m_callback.OnIndexedLoad(array, index, address, size);
+    }
+    OPCODE_CALLBACK(void OnPrimitiveCommand(OpcodeDecoder::Primitive primitive, u8 vat,
+                                            u32 vertex_size, u16 num_vertices,
+                                            const u8* vertex_data))
+    {
+      Push(Command::Type::Primitive).primitive = {primitive, vat, num_vertices, vertex_size};
+      m_callback.OnPrimitiveCommand(primitive, vat, vertex_size, num_vertices, vertex_data);
+    }
+    OPCODE_CALLBACK(void OnDisplayList(u32 address, u32 size))
+    {
+      Push(Command::Type::DisplayList).display_list = {address, size};
+      m_callback.OnDisplayList(address, size);
+    }
+    OPCODE_CALLBACK(void OnNop(u32 count))
+    {
+      Push(Command::Type::Nop).nop = {count};
+      m_callback.OnNop(count);
+    }
+    OPCODE_CALLBACK(void OnUnknown(u8 opcode, const u8* data))
+    {
+      Push(Command::Type::Unknown);
+      m_callback.OnUnknown(opcode, data);
+    }
+    OPCODE_CALLBACK(void OnCommand(const u8* data, u32 size))
+    {
+      m_commands.back().offset = static_cast<u32>(data - m_start);
+      m_commands.back().size = size;
+      m_callback.OnCommand(data, size);
+    }
+    OPCODE_CALLBACK(CPState& GetCPState()) { return m_callback.GetCPState(); }
+    OPCODE_CALLBACK(u32 GetVertexSize(u8 vat)) { return m_callback.GetVertexSize(vat); }
+
+  private:
+    Command& Push(Command::Type type)
+    {
+      Command& command = m_commands.emplace_back();
+      command.type = type;
+      return command;
+    }
+
+    const u8* m_start;
+    std::vector<Command>& m_commands;
+    T& m_callback;
+  };
+
+  // Returns the entry for a display list, with decoded set to false if the list hasn't been
+  // decoded before or has been modified since.
+  Entry& GetEntry(u32 address, u32 size, u64 write_generation);
+  void OnFrameEnd();
+
+  // Replays the commands of an entry, and returns the index of the first command which couldn't
+  // be replayed because the vertex format has changed.
+  template <typename T>
+  static size_t Replay(const Entry& entry, const u8* data, T& callback);
+
+  std::unordered_map<u64, Entry> m_entries;
+  u64 m_frame = 0;
+
+  Common::EventHook m_frame_event =
+      AfterFrameEvent::Register([this] { OnFrameEnd(); }, "DisplayListCache");
+};
+
+template <typename T>
+u32 DisplayListCache::Run(u32 address, u32 size, const u8* data, u64 write_generation,
+                          T& callback)
+{
+  Entry& entry = GetEntry(address, size, write_generation);
+
+  size_t first_command = 0;
+  if (entry.decoded)
+  {
+    first_command = Replay(entry, data, callback);
+    if (first_command == entry.commands.size())
+      return entry.decoded_size;
+  }
+
+  // Decode the list from the first command which couldn't be replayed, and keep the result for
+  // the next call.
+  const u32 offset = first_command == 0 ? 0 : entry.commands[first_command].offset;
+  entry.commands.resize(first_command);
+  Recorder<T> recorder(data, entry.commands, callback);
+  entry.decoded_size = offset + OpcodeDecoder::Run(data + offset, size - offset, recorder);
+  entry.decoded = true;
+  return entry.decoded_size;
+}
+
+template <typename T>
+size_t DisplayListCache::Replay(const Entry& entry, const u8* data, T& callback)
+{
+  for (size_t i = 0; i < entry.commands.size(); i++)
+  {
+    const Command& command = entry.commands[i];
+    const u8* const command_data = data + command.offset;
+    switch (command.type)
+    {
+    case Command::Type::Nop:
+      callback.OnNop(command.nop.count);
+      break;
+    case Command::Type::CP:
+      callback.OnCP(command.reg.command, command.reg.value);
+      break;
+    case Command::Type::XF:
+      callback.OnXF(command.xf.address, command.xf.count, command_data + 5);
+      break;
+    case Command::Type::BP:
+      callback.OnBP(command.reg.command, command.reg.value);
+      break;
+    case Command::Type::IndexedLoad:
+      callback.OnIndexedLoad(command.indexed_load.array, command.indexed_load.index,
+                             command.indexed_load.address, command.indexed_load.size);
+      break;
+    case Command::Type::Primitive:
+      if (callback.GetVertexSize(command.primitive.vat) != command.primitive.vertex_size)
+        return i;
+      callback.OnPrimitiveCommand(command.primitive.primitive, command.primitive.vat,
+                                  command.primitive.vertex_size, command.primitive.num_vertices,
+                                  command_data + 3);
+      break;
+    case Command::Type::DisplayList:
+      callback.OnDisplayList(command.display_list.address, command.display_list.size);
+      break;
+    case Command::Type::Unknown:
+      callback.OnUnknown(command_data[0], command_data);
+      break;
+    }
+    callback.OnCommand(command_data, command.size);
+  }
+  return entry.commands.size();
+}
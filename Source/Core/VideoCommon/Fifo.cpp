@@ -361,6 +361,7 @@ void FifoManager::RunGpuLoop(Core::System& system)
               if (old >= m_config_sync_gpu_max_distance &&
                   old - (int)cyclesExecuted < m_config_sync_gpu_max_distance)
               {
+                m_sync_wakeup_spin.OnSignal();
                 m_sync_wakeup_event.Set();
               }
             }
@@ -377,7 +378,10 @@ void FifoManager::RunGpuLoop(Core::System& system)
           {
             int old = m_sync_ticks.exchange(0);
             if (old >= m_config_sync_gpu_max_distance)
+            {
+              m_sync_wakeup_spin.OnSignal();
               m_sync_wakeup_event.Set();
+            }
           }
 
           // The fifo is empty and it's unlikely we will get any more work in the near future.
@@ -555,7 +559,7 @@ int FifoManager::WaitForGpuThread(Core::System& system, int ticks)
 
   // Wait for GPU
   if (now >= m_config_sync_gpu_max_distance)
-    m_sync_wakeup_event.Wait();
+    m_sync_wakeup_spin.Wait(m_sync_wakeup_event);
 
   return GPU_TIME_SLOT_SIZE;
 }
@@ -12,6 +12,7 @@
 #include "Common/Config/Config.h"
 #include "Common/Event.h"
 #include "Common/Flag.h"
+#include "Common/SpinWait.h"
 
 class PointerWrap;
 
@@ -75,6 +76,17 @@ public:
   void EmulatorState(bool running);
   void ResetVideoBuffer();
 
+  // How the GPU thread woke up after running out of work, in dual core mode.
+  Common::AdaptiveSpinWait::Stats GetGpuSleepStats() const
+  {
+    return m_gpu_mainloop.GetSleepStats();
+  }
+  // How the CPU thread woke up after waiting for the GPU thread to catch up, with SyncGPU.
+  Common::AdaptiveSpinWait::Stats GetSyncWakeupStats() const
+  {
+    return m_sync_wakeup_spin.GetStats();
+  }
+
 private:
   void RefreshConfig();
   void ReadDataFromFifo(Core::System& system, u32 readPtr);
@@ -121,6 +133,7 @@ private:
   std::atomic<int> m_sync_ticks = 0;
   bool m_syncing_suspended = false;
   Common::Event m_sync_wakeup_event;
+  Common::AdaptiveSpinWait m_sync_wakeup_spin;
 
   std::optional<Config::ConfigChangedCallbackID> m_config_callback_id = std::nullopt;
   bool m_config_sync_gpu = false;
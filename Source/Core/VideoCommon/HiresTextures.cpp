@@ -10,6 +10,7 @@
 #include <string_view>
 #include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 #include <xxhash.h>
@@ -35,6 +36,11 @@ constexpr std::string_view s_format_prefix{"tex1_"};
 static std::unordered_map<std::string, std::shared_ptr<HiresTexture>> s_hires_texture_cache;
 static std::unordered_map<std::string, bool> s_hires_texture_id_to_arbmipmap;
 
+// The order in which the game asked for textures during this session.
+static std::string s_load_order_game_id;
+static std::vector<std::string> s_load_order;
+static std::unordered_set<std::string> s_load_order_names;
+
 static auto s_file_library = std::make_shared<VideoCommon::DirectFilesystemAssetLibrary>();
 
 namespace
@@ -75,6 +81,49 @@ std::pair<std::string, bool> GetNameArbPair(const TextureInfo& texture_info)
 
   return {"", false};
 }
+
+std::string GetLoadOrderPath(const std::string& game_id)
+{
+  return fmt::format("{}HiresTextures/{}.loadorder", File::GetUserPath(D_CACHE_IDX), game_id);
+}
+
+void SaveLoadOrder()
+{
+  if (!s_load_order_game_id.empty() && !s_load_order.empty())
+  {
+    const std::string path = GetLoadOrderPath(s_load_order_game_id);
+    File::CreateFullPath(path);
+    if (!File::WriteStringToFile(path, JoinStrings(s_load_order, "\n")))
+      WARN_LOG_FMT(VIDEO, "Failed to write custom texture load order to {}", path);
+  }
+
+  s_load_order_game_id.clear();
+  s_load_order.clear();
+  s_load_order_names.clear();
+}
+
+void PrefetchTextures(const std::string& game_id)
+{
+  std::string load_order;
+  if (!File::ReadFileToString(GetLoadOrderPath(game_id), load_order))
+    return;
+
+  // The loader keeps the prefetched textures alive until they are searched for, and releases
+  // them first if it runs out of memory
+  auto& loader = Core::System::GetInstance().GetCustomAssetLoader();
+  size_t count = 0;
+  for (const std::string& name : SplitString(load_order, '\n'))
+  {
+    if (!s_hires_texture_id_to_arbmipmap.contains(name))
+      continue;
+
+    loader.PrefetchGameTexture(name, s_file_library);
+    count++;
+  }
+
+  if (count != 0)
+    INFO_LOG_FMT(VIDEO, "Prefetching {} custom textures", count);
+}
 }  // namespace
 
 void HiresTexture::Init()
@@ -96,6 +145,12 @@ void HiresTexture::Update()
   }
 
   const std::string& game_id = SConfig::GetInstance().GetGameID();
+  if (game_id != s_load_order_game_id)
+  {
+    SaveLoadOrder();
+    s_load_order_game_id = game_id;
+  }
+
   const std::set<std::string> texture_directories =
       GetTextureDirectoriesWithGameId(File::GetUserPath(D_HIRESTEXTURES_IDX), game_id);
   const std::vector<std::string> extensions{".png", ".dds"};
@@ -151,6 +206,12 @@ void HiresTexture::Update()
     }
   }
 
+  // With caching, every texture is being loaded already
+  if (g_ActiveConfig.bPrefetchHiresTextures && !g_ActiveConfig.bCacheHiresTextures)
+    PrefetchTextures(game_id);
+  else
+    system.GetCustomAssetLoader().ReleasePrefetchedAssets();
+
   if (g_ActiveConfig.bCacheHiresTextures)
   {
     OSD::AddMessage(fmt::format("Loading '{}' custom textures", s_hires_texture_cache.size()),
@@ -165,6 +226,8 @@ void HiresTexture::Update()
 
 void HiresTexture::Clear()
 {
+  SaveLoadOrder();
+  Core::System::GetInstance().GetCustomAssetLoader().ReleasePrefetchedAssets();
   s_hires_texture_cache.clear();
   s_hires_texture_id_to_arbmipmap.clear();
   s_file_library = std::make_shared<VideoCommon::DirectFilesystemAssetLibrary>();
@@ -176,12 +239,16 @@ std::shared_ptr<HiresTexture> HiresTexture::Search(const TextureInfo& texture_in
   if (base_filename == "")
     return nullptr;
 
+  if (s_load_order_names.insert(base_filename).second)
+    s_load_order.push_back(base_filename);
+
   if (auto iter = s_hires_texture_cache.find(base_filename); iter != s_hires_texture_cache.end())
   {
     return iter->second;
   }
   else
   {
+    // Prefetched textures are found by the loader as well
     auto& system = Core::System::GetInstance();
     auto hires_texture = std::make_shared<HiresTexture>(
         has_arb_mipmaps,
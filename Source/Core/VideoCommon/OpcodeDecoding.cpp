@@ -14,6 +14,8 @@
 
 #include "VideoCommon/OpcodeDecoding.h"
 
+#include <memory>
+
 #include "Common/Assert.h"
 #include "Common/Logging/Log.h"
 #include "Core/FifoPlayer/FifoRecorder.h"
@@ -23,11 +25,13 @@
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/CommandProcessor.h"
 #include "VideoCommon/DataReader.h"
+#include "VideoCommon/DisplayListCache.h"
 #include "VideoCommon/Fifo.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderBase.h"
 #include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VertexShaderManager.h"
+#include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/XFMemory.h"
 #include "VideoCommon/XFStructs.h"
 
@@ -35,6 +39,18 @@ namespace OpcodeDecoder
 {
 bool g_record_fifo_data = false;
 
+static std::unique_ptr<DisplayListCache> s_display_list_cache;
+
+void Init()
+{
+  s_display_list_cache = std::make_unique<DisplayListCache>();
+}
+
+void Shutdown()
+{
+  s_display_list_cache.reset();
+}
+
 template <bool is_preprocess>
 class RunCallback final : public Callback
 {
@@ -172,7 +188,8 @@ public:
         const u8* start_address;
 
         auto& fifo = system.GetFifo();
-        if (fifo.UseDeterministicGPUThread())
+        const bool deterministic_gpu_thread = fifo.UseDeterministicGPUThread();
+        if (deterministic_gpu_thread)
         {
           start_address = static_cast<u8*>(fifo.PopFifoAuxBuffer(size));
         }
@@ -188,7 +205,20 @@ public:
           // temporarily swap dl and non-dl (small "hack" for the stats)
           g_stats.SwapDL();
 
-          Run(start_address, size, *this);
+          // With the deterministic GPU thread, the list is a copy made by the preprocessing, which
+          // has no address to be identified by. Without the write tracking, modified lists could
+          // only be found by hashing them on every call, which costs as much as parsing them.
+          auto& memory = system.GetMemory();
+          if (g_ActiveConfig.bDisplayListCache && !deterministic_gpu_thread &&
+              s_display_list_cache && memory.AreCPUWritesTracked())
+          {
+            s_display_list_cache->Run(address, size, start_address,
+                                      memory.GetRangeWriteGeneration(address, size), *this);
+          }
+          else
+          {
+            Run(start_address, size, *this);
+          }
           INCSTAT(g_stats.this_frame.num_dlists_called);
 
           // un-swap
@@ -21,6 +21,9 @@ namespace OpcodeDecoder
 // Global flag to signal if FifoRecorder is active.
 extern bool g_record_fifo_data;
 
+void Init();
+void Shutdown();
+
 enum class Opcode
 {
   GX_NOP = 0x00,
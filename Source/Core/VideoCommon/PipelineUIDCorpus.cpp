@@ -0,0 +1,166 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/PipelineUIDCorpus.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+
+#include "Common/FileSearch.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+
+namespace VideoCommon
+{
+namespace
+{
+constexpr u32 CORPUS_FILE_MAGIC = 0x43495550;  // PUIC
+
+struct CorpusHeader
+{
+  u32 magic;
+  u32 uid_version;
+  u32 num_caches;
+  u32 num_uids;
+};
+
+struct CorpusEntry
+{
+  SerializedGXPipelineUid uid;
+  u32 num_games;
+};
+
+std::optional<std::vector<SerializedGXPipelineUid>> ReadPipelineUIDCache(const std::string& path)
+{
+  File::IOFile file(path, "rb");
+  u32 magic;
+  u32 version;
+  if (!file.ReadArray(&magic, 1) || !file.ReadArray(&version, 1) ||
+      magic != GX_PIPELINE_UID_CACHE_MAGIC || version != GX_PIPELINE_UID_VERSION)
+  {
+    return std::nullopt;
+  }
+
+  // A partially written UID at the end is ignored.
+  const u64 uid_count = (file.GetSize() - file.Tell()) / sizeof(SerializedGXPipelineUid);
+  std::vector<SerializedGXPipelineUid> uids(uid_count);
+  if (!file.ReadArray(uids.data(), uids.size()))
+    return std::nullopt;
+
+  return uids;
+}
+}  // namespace
+
+std::string GetPipelineUIDCorpusPath()
+{
+  return File::GetUserPath(D_CACHE_IDX) + "shared.uidcorpus";
+}
+
+std::optional<PipelineUIDCorpusStats>
+BuildPipelineUIDCorpus(const std::vector<std::string>& directories, const std::string& output_path,
+                       u32 max_uids)
+{
+  struct UIDCount
+  {
+    u32 num_games = 0;
+    u32 last_cache = 0;
+  };
+
+  // Keyed by the raw bytes of the UID, which have their padding cleared when serialized. The
+  // keys point into the caches, so they are kept around until the corpus is written.
+  std::unordered_map<std::string_view, UIDCount> counts;
+  std::vector<std::vector<SerializedGXPipelineUid>> caches;
+  for (const std::string& path :
+       Common::DoFileSearch(directories, {GX_PIPELINE_UID_CACHE_EXTENSION}, false))
+  {
+    auto uids = ReadPipelineUIDCache(path);
+    if (!uids)
+    {
+      WARN_LOG_FMT(VIDEO, "Skipping pipeline UID cache {} with a different version", path);
+      continue;
+    }
+
+    caches.push_back(std::move(*uids));
+    const u32 cache_number = static_cast<u32>(caches.size());
+    for (const SerializedGXPipelineUid& uid : caches.back())
+    {
+      const std::string_view key(reinterpret_cast<const char*>(&uid), sizeof(uid));
+      UIDCount& count = counts[key];
+
+      // Games are only counted once, even if their cache lists a UID more than once.
+      if (count.last_cache != cache_number)
+      {
+        count.num_games++;
+        count.last_cache = cache_number;
+      }
+    }
+  }
+
+  std::vector<std::pair<std::string_view, u32>> ranked;
+  ranked.reserve(counts.size());
+  for (const auto& [key, count] : counts)
+    ranked.emplace_back(key, count.num_games);
+  std::sort(ranked.begin(), ranked.end(), [](const auto& a, const auto& b) {
+    return a.second != b.second ? a.second > b.second : a.first < b.first;
+  });
+  if (ranked.size() > max_uids)
+    ranked.resize(max_uids);
+
+  const std::string temp_path = File::GetTempFilenameForAtomicWrite(output_path);
+  {
+    File::IOFile file(temp_path, "wb");
+    const CorpusHeader header{CORPUS_FILE_MAGIC, GX_PIPELINE_UID_VERSION,
+                              static_cast<u32>(caches.size()), static_cast<u32>(ranked.size())};
+    file.WriteArray(&header, 1);
+    for (const auto& [key, num_games] : ranked)
+    {
+      CorpusEntry entry;
+      std::memcpy(&entry.uid, key.data(), sizeof(entry.uid));
+      entry.num_games = num_games;
+      file.WriteArray(&entry, 1);
+    }
+
+    if (!file.Close())
+    {
+      ERROR_LOG_FMT(VIDEO, "Failed to write pipeline UID corpus to {}", temp_path);
+      File::Delete(temp_path);
+      return std::nullopt;
+    }
+  }
+
+  if (!File::Rename(temp_path, output_path))
+  {
+    File::Delete(temp_path);
+    return std::nullopt;
+  }
+
+  return PipelineUIDCorpusStats{static_cast<u32>(caches.size()), static_cast<u32>(ranked.size())};
+}
+
+std::vector<SerializedGXPipelineUid> ReadPipelineUIDCorpus(const std::string& path, u32 max_uids)
+{
+  File::IOFile file(path, "rb");
+  CorpusHeader header;
+  if (!file.ReadArray(&header, 1) || header.magic != CORPUS_FILE_MAGIC)
+    return {};
+
+  if (header.uid_version != GX_PIPELINE_UID_VERSION)
+  {
+    WARN_LOG_FMT(VIDEO, "Ignoring pipeline UID corpus {} with UID version {}", path,
+                 header.uid_version);
+    return {};
+  }
+
+  const u32 num_uids = std::min(header.num_uids, max_uids);
+  std::vector<SerializedGXPipelineUid> uids;
+  uids.reserve(num_uids);
+  CorpusEntry entry;
+  while (uids.size() < num_uids && file.ReadArray(&entry, 1))
+    uids.push_back(entry.uid);
+
+  return uids;
+}
+}  // namespace VideoCommon
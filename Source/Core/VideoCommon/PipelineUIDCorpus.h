@@ -0,0 +1,38 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/GXPipelineTypes.h"
+
+namespace VideoCommon
+{
+// Per-game pipeline UID caches, as written by the shader cache.
+constexpr u32 GX_PIPELINE_UID_CACHE_MAGIC = 0x44495550;  // PUID
+constexpr char GX_PIPELINE_UID_CACHE_EXTENSION[] = ".uidcache";
+
+// The shared pipeline UID corpus is built from the pipeline UID caches of many games. It lists
+// each UID once, ordered by the number of games which use it, so that the pipelines a game is
+// most likely to need can be compiled before the game has a UID cache of its own.
+struct PipelineUIDCorpusStats
+{
+  u32 num_caches = 0;
+  u32 num_uids = 0;
+};
+
+std::string GetPipelineUIDCorpusPath();
+
+// Gathers the UIDs of all pipeline UID caches in the given directories into a new corpus,
+// keeping at most max_uids of them. Caches from other versions of the UID format are skipped.
+std::optional<PipelineUIDCorpusStats>
+BuildPipelineUIDCorpus(const std::vector<std::string>& directories, const std::string& output_path,
+                       u32 max_uids);
+
+// Returns up to max_uids UIDs from the corpus, starting with the most commonly used ones.
+std::vector<SerializedGXPipelineUid> ReadPipelineUIDCorpus(const std::string& path, u32 max_uids);
+}  // namespace VideoCommon
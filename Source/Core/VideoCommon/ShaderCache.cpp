@@ -15,6 +15,7 @@
 #include "VideoCommon/DriverDetails.h"
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/FramebufferShaderGen.h"
+#include "VideoCommon/PipelineUIDCorpus.h"
 #include "VideoCommon/Present.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderManager.h"
@@ -56,10 +57,12 @@ void ShaderCache::InitializeShaderCache()
   m_async_shader_compiler->ResizeWorkerThreads(g_ActiveConfig.GetShaderPrecompilerThreads());
 
   // Load shader and UID caches.
+  bool first_run = false;
   if (g_ActiveConfig.bShaderCache && m_api_type != APIType::Nothing)
   {
     LoadCaches();
     LoadPipelineUIDCache();
+    first_run = m_gx_pipeline_cache.empty();
   }
 
   // Queue ubershader precompiling if required.
@@ -73,6 +76,13 @@ void ShaderCache::InitializeShaderCache()
 
   // Switch to the runtime shader compiler thread configuration.
   m_async_shader_compiler->ResizeWorkerThreads(g_ActiveConfig.GetShaderCompilerThreads());
+
+  // Without any background threads, these would all be compiled right away on this thread.
+  if (first_run && g_ActiveConfig.bPrewarmSharedPipelines &&
+      g_ActiveConfig.GetShaderCompilerThreads() > 0)
+  {
+    QueueSharedCorpusPipelines();
+  }
 }
 
 void ShaderCache::Reload()
@@ -102,6 +112,16 @@ void ShaderCache::Reload()
 void ShaderCache::RetrieveAsyncShaders()
 {
   m_async_shader_compiler->RetrieveWorkItems();
+
+  // Once the corpus has finished compiling, stop checking every lookup against it. Corpus pipelines
+  // first used after this point only get added to the game's UID cache in a later session.
+  if (!m_shared_corpus_uids.empty() && !m_async_shader_compiler->HasPendingWork() &&
+      !m_async_shader_compiler->HasCompletedWork())
+  {
+    INFO_LOG_FMT(VIDEO, "Finished prewarming shared pipelines, {} were not used",
+                 m_shared_corpus_uids.size());
+    m_shared_corpus_uids.clear();
+  }
 }
 
 void ShaderCache::Shutdown()
@@ -116,10 +136,16 @@ void ShaderCache::Shutdown()
 
 const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid)
 {
+  if (!m_shared_corpus_uids.empty())
+    OnSharedCorpusPipelineUsed(uid);
+
   auto it = m_gx_pipeline_cache.find(uid);
   if (it != m_gx_pipeline_cache.end() && !it->second.second)
     return it->second.first.get();
 
+  INCSTAT(g_stats.timings.num_shader_compile_stalls);
+  StatTimer timer(g_stats.timings.shader_compile_stall_time);
+
   const bool exists_in_cache = it != m_gx_pipeline_cache.end();
   std::unique_ptr<AbstractPipeline> pipeline;
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
@@ -132,6 +158,9 @@ const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid)
 
 std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const GXPipelineUid& uid)
 {
+  if (!m_shared_corpus_uids.empty())
+    OnSharedCorpusPipelineUsed(uid);
+
   auto it = m_gx_pipeline_cache.find(uid);
   if (it != m_gx_pipeline_cache.end())
   {
@@ -153,6 +182,9 @@ const AbstractPipeline* ShaderCache::GetUberPipelineForUid(const GXUberPipelineU
   if (it != m_gx_uber_pipeline_cache.end() && !it->second.second)
     return it->second.first.get();
 
+  INCSTAT(g_stats.timings.num_shader_compile_stalls);
+  StatTimer timer(g_stats.timings.shader_compile_stall_time);
+
   std::unique_ptr<AbstractPipeline> pipeline;
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
   if (pipeline_config)
@@ -922,10 +954,10 @@ ShaderCache::InsertGXUberPipeline(const GXUberPipelineUid& config,
 
 void ShaderCache::LoadPipelineUIDCache()
 {
-  constexpr u32 CACHE_FILE_MAGIC = 0x44495550;  // PUID
+  constexpr u32 CACHE_FILE_MAGIC = GX_PIPELINE_UID_CACHE_MAGIC;
   constexpr size_t CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
-  std::string filename =
-      File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".uidcache";
+  std::string filename = File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() +
+                         GX_PIPELINE_UID_CACHE_EXTENSION;
   if (m_gx_pipeline_uid_cache_file.Open(filename, "rb+"))
   {
     // If an existing case exists, validate the version before reading entries.
@@ -1027,6 +1059,31 @@ void ShaderCache::AppendGXPipelineUID(const GXPipelineUid& config)
   }
 }
 
+void ShaderCache::QueueSharedCorpusPipelines()
+{
+  const std::string path = GetPipelineUIDCorpusPath();
+  for (const SerializedGXPipelineUid& serialized_uid :
+       ReadPipelineUIDCorpus(path, MAX_SHARED_CORPUS_PIPELINES))
+  {
+    GXPipelineUid uid;
+    UnserializePipelineUid(serialized_uid, uid);
+    if (m_gx_pipeline_cache.contains(uid))
+      continue;
+
+    m_shared_corpus_uids.insert(uid);
+    QueuePipelineCompile(uid, COMPILE_PRIORITY_SHARED_CORPUS_PIPELINE);
+  }
+
+  INFO_LOG_FMT(VIDEO, "Queued {} shared pipelines from {}", m_shared_corpus_uids.size(), path);
+}
+
+void ShaderCache::OnSharedCorpusPipelineUsed(const GXPipelineUid& uid)
+{
+  // Pipelines from the corpus are only added to the game's UID cache once the game uses them.
+  if (m_shared_corpus_uids.erase(uid) != 0)
+    AppendGXPipelineUID(uid);
+}
+
 void ShaderCache::QueueVertexShaderCompile(const VertexShaderUid& uid, u32 priority)
 {
   class VertexShaderWorkItem final : public AsyncShaderCompiler::WorkItem
@@ -9,6 +9,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <set>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -161,6 +162,8 @@ private:
                                                std::unique_ptr<AbstractPipeline> pipeline);
   void AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid);
   void AppendGXPipelineUID(const GXPipelineUid& config);
+  void QueueSharedCorpusPipelines();
+  void OnSharedCorpusPipelineUsed(const GXPipelineUid& uid);
 
   // ASync Compiler Methods
   void QueueVertexShaderCompile(const VertexShaderUid& uid, u32 priority);
@@ -184,14 +187,19 @@ private:
   // Priorities for compiling. The lower the value, the sooner the pipeline is compiled.
   // The shader cache is compiled last, as it is the least likely to be required. On demand
   // shaders are always compiled before pending ubershaders, as we want to use the ubershader
-  // for as few frames as possible, otherwise we risk framerate drops.
+  // for as few frames as possible, otherwise we risk framerate drops. Pipelines from the shared
+  // corpus were never used by this game, so they come after everything else.
   enum : u32
   {
     COMPILE_PRIORITY_ONDEMAND_PIPELINE = 100,
     COMPILE_PRIORITY_UBERSHADER_PIPELINE = 200,
-    COMPILE_PRIORITY_SHADERCACHE_PIPELINE = 300
+    COMPILE_PRIORITY_SHADERCACHE_PIPELINE = 300,
+    COMPILE_PRIORITY_SHARED_CORPUS_PIPELINE = 400
   };
 
+  // Upper bound on the number of pipelines compiled from the shared corpus on a first run.
+  static constexpr u32 MAX_SHARED_CORPUS_PIPELINES = 4096;
+
   // Configuration bits.
   APIType m_api_type;
   ShaderHostConfig m_host_config = {};
@@ -229,6 +237,8 @@ private:
   std::map<GXUberPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>>
       m_gx_uber_pipeline_cache;
   File::IOFile m_gx_pipeline_uid_cache_file;
+  // Pipelines queued from the shared corpus which the game hasn't used yet.
+  std::set<GXPipelineUid> m_shared_corpus_uids;
   Common::LinearDiskCache<SerializedGXPipelineUid, u8> m_gx_pipeline_disk_cache;
   Common::LinearDiskCache<SerializedGXUberPipelineUid, u8> m_gx_uber_pipeline_disk_cache;
 
@@ -3,6 +3,7 @@
 
 #include "VideoCommon/Statistics.h"
 
+#include <algorithm>
 #include <cstring>
 #include <utility>
 
@@ -10,8 +11,10 @@
 
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/SystemTimers.h"
+#include "Core/System.h"
 
 #include "VideoCommon/BPFunctions.h"
+#include "VideoCommon/Fifo.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/VideoEvents.h"
@@ -89,6 +92,13 @@ void Statistics::Display() const
   draw_statistic("Textures created", "%d", num_textures_created);
   draw_statistic("Textures uploaded", "%d", num_textures_uploaded);
   draw_statistic("Textures alive", "%d", num_textures_alive);
+  draw_statistic("Texture cache hits", "%d/%d",
+                 this_frame.num_texture_cache_lookups - this_frame.num_texture_cache_misses,
+                 this_frame.num_texture_cache_lookups);
+  draw_statistic("Textures evicted", "%d", this_frame.num_textures_evicted);
+  draw_statistic("Texture uploads", "%i kB", this_frame.bytes_texture_uploaded / 1024);
+  draw_statistic("Texture cache size", "%zu MB", texture_cache_size >> 20);
+  draw_statistic("Texture pool size", "%zu MB", texture_pool_size >> 20);
   draw_statistic("pshaders created", "%d", num_pixel_shaders_created);
   draw_statistic("pshaders alive", "%d", num_pixel_shaders_alive);
   draw_statistic("vshaders created", "%d", num_vertex_shaders_created);
@@ -114,6 +124,24 @@ void Statistics::Display() const
   draw_statistic("Draw dones:", "%d", this_frame.num_draw_done);
   draw_statistic("Tokens:", "%d/%d", this_frame.num_token, this_frame.num_token_int);
 
+  auto& system = Core::System::GetInstance();
+  if (system.IsDualCoreMode())
+  {
+    const auto draw_wakeups = [&](const char* name, const char* latency_name,
+                                  const Common::AdaptiveSpinWait::Stats& stats) {
+      draw_statistic(name, "%llu spun, %llu slept",
+                     static_cast<unsigned long long>(stats.spin_wakeups),
+                     static_cast<unsigned long long>(stats.sleep_wakeups));
+      const double average_latency = static_cast<double>(stats.total_wakeup_latency_ns) /
+                                     static_cast<double>(std::max<u64>(stats.sleep_wakeups, 1));
+      draw_statistic(latency_name, "%.1f us avg, %.1f us max", average_latency / 1000.0,
+                     static_cast<double>(stats.max_wakeup_latency_ns) / 1000.0);
+    };
+    const auto& fifo = system.GetFifo();
+    draw_wakeups("GPU wakeups:", "GPU wakeup latency:", fifo.GetGpuSleepStats());
+    draw_wakeups("Sync wakeups:", "Sync wakeup latency:", fifo.GetSyncWakeupStats());
+  }
+
   ImGui::Columns(1);
 
   ImGui::End();
@@ -4,8 +4,12 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <vector>
 
+#include "Common/CommonTypes.h"
+
 #include "VideoCommon/BPFunctions.h"
 
 struct Statistics
@@ -18,6 +22,9 @@ struct Statistics
   int num_textures_created = 0;
   int num_textures_uploaded = 0;
   int num_textures_alive = 0;
+  // Memory used by the textures of the texture cache and of its pool of unused textures, in bytes.
+  size_t texture_cache_size = 0;
+  size_t texture_pool_size = 0;
 
   int num_vertex_loaders = 0;
 
@@ -35,6 +42,22 @@ struct Statistics
   bool show_viewports = false;
   bool show_text = true;
 
+  // Enables the timing statistics below. Used by the FifoPlayer benchmark, which sets it on the
+  // CPU thread.
+  std::atomic<bool> collect_timings = false;
+
+  // Time spent on the GPU thread in nanoseconds, only measured when collect_timings is set. Unlike
+  // this_frame, these are not reset at the first draw of a frame, so that the work done before it
+  // is counted as well. Whoever collects them resets them.
+  struct Timings
+  {
+    u64 vertex_loader_time = 0;
+    u64 texture_decode_time = 0;
+    u64 shader_compile_stall_time = 0;
+    int num_shader_compile_stalls = 0;
+  };
+  Timings timings;
+
   struct ThisFrame
   {
     int num_bp_loads = 0;
@@ -69,6 +92,11 @@ struct Statistics
     int tev_pixels_in = 0;
     int tev_pixels_out = 0;
 
+    int num_texture_cache_lookups = 0;
+    int num_texture_cache_misses = 0;
+    int num_textures_evicted = 0;
+    int bytes_texture_uploaded = 0;
+
     int num_efb_peeks = 0;
     int num_efb_pokes = 0;
 
@@ -87,6 +115,34 @@ struct Statistics
 
 extern Statistics g_stats;
 
+// Adds the time spent until the end of the scope to a timing statistic if timings are collected.
+class StatTimer
+{
+public:
+  explicit StatTimer(u64& stat)
+      : m_stat(g_stats.collect_timings.load(std::memory_order_relaxed) ? &stat : nullptr)
+  {
+    if (m_stat)
+      m_start = std::chrono::steady_clock::now();
+  }
+  ~StatTimer()
+  {
+    if (m_stat)
+    {
+      *m_stat += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                     std::chrono::steady_clock::now() - m_start)
+                     .count();
+    }
+  }
+
+  StatTimer(const StatTimer&) = delete;
+  StatTimer& operator=(const StatTimer&) = delete;
+
+private:
+  u64* m_stat;
+  std::chrono::steady_clock::time_point m_start;
+};
+
 #define STATISTICS
 
 #ifdef STATISTICS
@@ -111,6 +111,8 @@ void TextureCacheBase::Shutdown()
 
   HiresTexture::Shutdown();
 
+  m_decode_pool.Shutdown();
+
   // For correctness, we need to invalidate textures before the gpu context starts shutting down.
   Invalidate();
 }
@@ -787,9 +789,93 @@ void TextureCacheBase::OnFrameEnd()
   // Flush any outstanding EFB copies to RAM, in case the game is running at an uncapped frame
   // rate and not waiting for vblank. Otherwise, we'd end up with a huge list of pending
   // copies.
-  FlushEFBCopies();
+  FlushDueEFBCopies();
 
   Cleanup(g_presenter->FrameCount());
+  EnforceMemoryBudget(g_presenter->FrameCount());
+}
+
+void TextureCacheBase::EnforceMemoryBudget(int frame_count)
+{
+  // Without a budget, the sizes are only needed for the statistics, and adding them up walks
+  // through every texture.
+  const size_t budget = static_cast<size_t>(std::max(g_ActiveConfig.iTextureCacheBudget, 0))
+                        << 20;
+  if (budget == 0 && !g_ActiveConfig.bOverlayStats)
+  {
+    SETSTAT(g_stats.num_textures_alive, static_cast<int>(m_textures_by_address.size()));
+    return;
+  }
+
+  size_t cache_size = 0;
+  for (const auto& [address, entry] : m_textures_by_address)
+  {
+    if (entry->texture)
+      cache_size += entry->texture->GetConfig().GetSizeInBytes();
+  }
+  const auto get_pool_size = [this] {
+    size_t size = 0;
+    for (const auto& [config, entry] : m_texture_pool)
+      size += config.GetSizeInBytes();
+    return size;
+  };
+  size_t pool_size = get_pool_size();
+
+  if (budget != 0 && cache_size + pool_size > budget)
+  {
+    const auto trim_pool = [&] {
+      std::vector<TexPool::iterator> pool_entries;
+      for (auto iter = m_texture_pool.begin(); iter != m_texture_pool.end(); ++iter)
+        pool_entries.push_back(iter);
+      std::sort(pool_entries.begin(), pool_entries.end(), [](const auto& a, const auto& b) {
+        return a->second.frameCount < b->second.frameCount;
+      });
+      for (const TexPool::iterator& iter : pool_entries)
+      {
+        if (cache_size + pool_size <= budget)
+          break;
+        pool_size -= iter->first.GetSizeInBytes();
+        m_texture_pool.erase(iter);
+        INCSTAT(g_stats.this_frame.num_textures_evicted);
+      }
+    };
+
+    trim_pool();
+
+    if (cache_size > budget)
+    {
+      std::vector<TexAddrCache::iterator> cache_entries;
+      for (auto iter = m_textures_by_address.begin(); iter != m_textures_by_address.end(); ++iter)
+      {
+        const TCacheEntry& entry = *iter->second;
+        if (entry.texture && !entry.IsCopy() && !entry.IsLocked() &&
+            entry.frameCount != frame_count)
+        {
+          cache_entries.push_back(iter);
+        }
+      }
+      std::sort(cache_entries.begin(), cache_entries.end(), [](const auto& a, const auto& b) {
+        return a->second->frameCount < b->second->frameCount;
+      });
+
+      // The textures of evicted entries only go back into the pool once nothing references them
+      // anymore (e.g. they may still be bound), so the pool is measured again before trimming it.
+      for (const TexAddrCache::iterator& iter : cache_entries)
+      {
+        if (cache_size <= budget)
+          break;
+        cache_size -= iter->second->texture->GetConfig().GetSizeInBytes();
+        InvalidateTexture(iter);
+        INCSTAT(g_stats.this_frame.num_textures_evicted);
+      }
+      pool_size = get_pool_size();
+      trim_pool();
+    }
+  }
+
+  g_stats.texture_cache_size = cache_size;
+  g_stats.texture_pool_size = pool_size;
+  SETSTAT(g_stats.num_textures_alive, static_cast<int>(m_textures_by_address.size()));
 }
 
 void TCacheEntry::DoState(PointerWrap& p)
@@ -1293,6 +1379,8 @@ TCacheEntry* TextureCacheBase::Load(const TextureInfo& texture_info)
 
 TCacheEntry* TextureCacheBase::LoadImpl(const TextureInfo& texture_info, bool force_reload)
 {
+  INCSTAT(g_stats.this_frame.num_texture_cache_lookups);
+
   // if this stage was not invalidated by changes to texture registers, keep the current texture
   if (!force_reload && TMEM::IsValid(texture_info.GetStage()) &&
       m_bound_textures[texture_info.GetStage()])
@@ -1312,9 +1400,9 @@ TCacheEntry* TextureCacheBase::LoadImpl(const TextureInfo& texture_info, bool fo
       return entry;
     }
 
-    // Otherwise, hash the backing memory and check it's unchanged.
+    // Otherwise, check the backing memory is unchanged.
     // FIXME: this doesn't correctly handle textures from tmem.
-    if (!entry->invalidated && entry->base_hash == entry->CalculateHash())
+    if (!entry->invalidated && entry->IsBaseHashCurrent())
     {
       return entry;
     }
@@ -1384,6 +1472,12 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
                                           MemoryUpdate::Type::TextureMap);
   }
 
+  if (!texture_info.IsFromTmem())
+  {
+    FlushEFBCopiesForRead(texture_info.GetRawAddress(), texture_info.GetFullLevelSize(),
+                          texture_info.GetRawWidth(), texture_info.GetRawHeight());
+  }
+
   // TODO: This doesn't hash GB tiles for preloaded RGBA8 textures (instead, it's hashing more data
   // from the low tmem bank than it should)
   base_hash = Common::GetHash64(texture_info.GetData(), texture_info.GetTextureSize(),
@@ -1756,6 +1850,10 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
 
     ArbitraryMipmapDetector arbitrary_mip_detector;
 
+    // Levels which are decoded on the CPU are collected first, so that they can be decoded in
+    // parallel, and are then uploaded in order.
+    m_cpu_decode_levels.clear();
+
     // Initialized to null because only software loading uses this buffer
     u8* dst_buffer = nullptr;
 
@@ -1786,23 +1884,8 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
 
       CheckTempSize(total_texture_size);
       dst_buffer = m_temp;
-      if (!(texture_info.GetTextureFormat() == TextureFormat::RGBA8 && texture_info.IsFromTmem()))
-      {
-        TexDecoder_Decode(dst_buffer, texture_info.GetData(), expanded_width, expanded_height,
-                          texture_info.GetTextureFormat(), texture_info.GetTlutAddress(),
-                          texture_info.GetTlutFormat());
-      }
-      else
-      {
-        TexDecoder_DecodeRGBA8FromTmem(dst_buffer, texture_info.GetData(),
-                                       texture_info.GetTmemOddAddress(), expanded_width,
-                                       expanded_height);
-      }
-
-      entry->texture->Load(0, width, height, expanded_width, dst_buffer, decoded_texture_size);
-
-      arbitrary_mip_detector.AddLevel(width, height, expanded_width, dst_buffer);
-
+      m_cpu_decode_levels.push_back({0, texture_info.GetData(), dst_buffer, width, height,
+                                     expanded_width, expanded_height});
       dst_buffer += decoded_texture_size;
     }
 
@@ -1822,21 +1905,26 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
                               texture_info.GetTlutAddress(), texture_info.GetTlutFormat()))
       {
         // No need to call CheckTempSize here, as the whole buffer is preallocated at the beginning
-        const u32 decoded_mip_size =
-            mip_level->GetExpandedWidth() * sizeof(u32) * mip_level->GetExpandedHeight();
-        TexDecoder_Decode(dst_buffer, mip_level->GetData(), mip_level->GetExpandedWidth(),
-                          mip_level->GetExpandedHeight(), texture_info.GetTextureFormat(),
-                          texture_info.GetTlutAddress(), texture_info.GetTlutFormat());
-        entry->texture->Load(level, mip_level->GetRawWidth(), mip_level->GetRawHeight(),
-                             mip_level->GetExpandedWidth(), dst_buffer, decoded_mip_size);
-
-        arbitrary_mip_detector.AddLevel(mip_level->GetRawWidth(), mip_level->GetRawHeight(),
-                                        mip_level->GetExpandedWidth(), dst_buffer);
-
-        dst_buffer += decoded_mip_size;
+        m_cpu_decode_levels.push_back({level, mip_level->GetData(), dst_buffer,
+                                       mip_level->GetRawWidth(), mip_level->GetRawHeight(),
+                                       mip_level->GetExpandedWidth(),
+                                       mip_level->GetExpandedHeight()});
+        dst_buffer += mip_level->GetExpandedWidth() * sizeof(u32) * mip_level->GetExpandedHeight();
       }
     }
 
+    DecodeLevelsOnCPU(texture_info, creation_info.bytes_per_block, m_cpu_decode_levels);
+
+    for (const CPUDecodeLevel& level : m_cpu_decode_levels)
+    {
+      const size_t decoded_size = level.expanded_width * sizeof(u32) * level.expanded_height;
+      entry->texture->Load(level.level, level.raw_width, level.raw_height, level.expanded_width,
+                           level.dst, decoded_size);
+
+      arbitrary_mip_detector.AddLevel(level.raw_width, level.raw_height, level.expanded_width,
+                                      level.dst);
+    }
+
     entry->has_arbitrary_mips = arbitrary_mip_detector.HasArbitraryMipmaps(dst_buffer);
 
     if (g_ActiveConfig.bDumpTextures && !skip_texture_dump)
@@ -1868,6 +1956,9 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
   entry->SetNotCopy();
 
   INCSTAT(g_stats.num_textures_uploaded);
+  INCSTAT(g_stats.this_frame.num_texture_cache_misses);
+  ADDSTAT(g_stats.this_frame.bytes_texture_uploaded,
+          entry->texture->GetConfig().GetSizeInBytes());
   SETSTAT(g_stats.num_textures_alive, static_cast<int>(m_textures_by_address.size()));
 
   entry = DoPartialTextureUpdates(iter->second, texture_info.GetTlutAddress(),
@@ -1879,6 +1970,77 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
   return entry;
 }
 
+void TextureCacheBase::DecodeLevelsOnCPU(const TextureInfo& texture_info, u32 bytes_per_block,
+                                         std::span<const CPUDecodeLevel> levels)
+{
+  StatTimer timer(g_stats.timings.texture_decode_time);
+
+  // Levels below this size are not worth splitting up any further.
+  constexpr u32 MIN_TEXELS_PER_BAND = 128 * 128;
+
+  const TextureFormat format = texture_info.GetTextureFormat();
+  const bool rgba8_from_tmem = format == TextureFormat::RGBA8 && texture_info.IsFromTmem();
+  const u32 block_width = texture_info.GetBlockWidth();
+  const u32 block_height = texture_info.GetBlockHeight();
+
+  const auto decode = [&](const CPUDecodeLevel& level, u32 first_row, u32 num_rows) {
+    if (level.level == 0 && rgba8_from_tmem)
+    {
+      TexDecoder_DecodeRGBA8FromTmem(level.dst, level.src, texture_info.GetTmemOddAddress(),
+                                     level.expanded_width, level.expanded_height);
+      return;
+    }
+
+    const u32 row_stride = bytes_per_block * (level.expanded_width / block_width);
+    TexDecoder_Decode(level.dst + first_row * block_height * level.expanded_width * sizeof(u32),
+                      level.src + first_row * row_stride, level.expanded_width,
+                      num_rows * block_height, format, texture_info.GetTlutAddress(),
+                      texture_info.GetTlutFormat());
+  };
+
+  const u32 num_threads = g_ActiveConfig.GetTextureDecodingThreads();
+  if (num_threads == 0)
+  {
+    for (const CPUDecodeLevel& level : levels)
+      decode(level, 0, level.expanded_height / block_height);
+    return;
+  }
+
+  // Large levels are split into bands of block rows. This isn't possible when the format overlay
+  // is drawn, as it is placed relative to the whole level.
+  struct Band
+  {
+    const CPUDecodeLevel* level;
+    u32 first_row;
+    u32 num_rows;
+  };
+  std::vector<Band> bands;
+  for (const CPUDecodeLevel& level : levels)
+  {
+    const u32 num_rows = level.expanded_height / block_height;
+    u32 num_bands = 1;
+    if (!(level.level == 0 && rgba8_from_tmem) && !m_backup_config.texfmt_overlay)
+    {
+      const u32 texels = level.expanded_width * level.expanded_height;
+      num_bands = std::clamp(texels / MIN_TEXELS_PER_BAND, 1u, std::min(num_rows, num_threads + 1));
+    }
+
+    for (u32 band = 0; band < num_bands; band++)
+    {
+      const u32 first_row = num_rows * band / num_bands;
+      const u32 end_row = num_rows * (band + 1) / num_bands;
+      bands.push_back({&level, first_row, end_row - first_row});
+    }
+  }
+
+  if (m_decode_pool.GetThreadCount() != num_threads)
+    m_decode_pool.Reset("Texture Decoding", num_threads);
+
+  m_decode_pool.ParallelFor(static_cast<u32>(bands.size()), [&](u32 index) {
+    decode(*bands[index].level, bands[index].first_row, bands[index].num_rows);
+  });
+}
+
 static void GetDisplayRectForXFBEntry(TCacheEntry* entry, u32 width, u32 height,
                                       MathUtil::Rectangle<int>* display_rect)
 {
@@ -1901,6 +2063,8 @@ RcTcacheEntry TextureCacheBase::GetXFBTexture(u32 address, u32 width, u32 height
     return {};
   }
 
+  FlushEFBCopiesForRead(address, stride * height, width, height);
+
   // Do we currently have a mutable version of this XFB copy in VRAM?
   RcTcacheEntry entry = GetXFBFromCache(address, width, height, stride);
   if (entry && !entry->IsLocked())
@@ -1950,6 +2114,8 @@ RcTcacheEntry TextureCacheBase::GetXFBTexture(u32 address, u32 width, u32 height
   m_textures_by_address.emplace(entry->addr, entry);
   SETSTAT(g_stats.num_textures_alive, static_cast<int>(m_textures_by_address.size()));
   INCSTAT(g_stats.num_textures_uploaded);
+  ADDSTAT(g_stats.this_frame.bytes_texture_uploaded,
+          entry->texture->GetConfig().GetSizeInBytes());
 
   if (g_ActiveConfig.bDumpXFBTarget || g_ActiveConfig.bGraphicMods)
   {
@@ -2345,7 +2511,10 @@ void TextureCacheBase::CopyRenderTargetToTexture(
       if (skip == true)
       {
         if (copy_to_ram)
+        {
           UninitializeEFBMemory(dst, dstStride, bytes_per_row, num_blocks_y);
+          memory.MarkRangeWritten(dstAddr, covered_range);
+        }
         return;
       }
     }
@@ -2464,6 +2633,7 @@ void TextureCacheBase::CopyRenderTargetToTexture(
         entry->pending_efb_copy = std::move(staging_texture);
         entry->pending_efb_copy_width = bytes_per_row / sizeof(u32);
         entry->pending_efb_copy_height = num_blocks_y;
+        entry->pending_efb_copy_frame = g_presenter->FrameCount();
         m_pending_efb_copies.push_back(entry);
       }
     }
@@ -2480,6 +2650,9 @@ void TextureCacheBase::CopyRenderTargetToTexture(
     }
   }
 
+  // Deferred copies are reported again when they are flushed.
+  memory.MarkRangeWritten(dstAddr, covered_range);
+
   // Invalidate all textures, if they are either fully overwritten by our efb copy, or if they
   // have a different stride than our efb copy. Partly overwritten textures with the same stride
   // as our efb copy are marked to check them for partial texture updates.
@@ -2561,18 +2734,99 @@ void TextureCacheBase::CopyRenderTargetToTexture(
   {
     const u64 hash = entry->CalculateHash();
     entry->SetHashes(hash, hash);
+    if (entry->pending_efb_copy)
+    {
+      entry->pending_efb_copy_write_generation =
+          memory.GetRangeWriteGeneration(dstAddr, covered_range);
+      entry->pending_efb_copy_memory_hash = hash;
+    }
     m_textures_by_address.emplace(dstAddr, std::move(entry));
   }
 }
 
 void TextureCacheBase::FlushEFBCopies()
 {
-  if (m_pending_efb_copies.empty())
+  FlushEFBCopies(m_pending_efb_copies.size());
+}
+
+void TextureCacheBase::FlushEFBCopies(size_t count)
+{
+  if (count == 0)
     return;
 
-  for (auto& entry : m_pending_efb_copies)
-    FlushEFBCopy(entry.get());
-  m_pending_efb_copies.clear();
+  // Wait for the most recent copy first. The copies are done in order, so the older ones have
+  // finished by then, and reading them back doesn't need another wait on the GPU.
+  m_pending_efb_copies[count - 1]->pending_efb_copy->Flush();
+
+  auto& memory = Core::System::GetInstance().GetMemory();
+  for (size_t i = 0; i < count; i++)
+  {
+    TCacheEntry* entry = m_pending_efb_copies[i].get();
+    const u32 address = entry->addr;
+    const u32 size = entry->pending_efb_copy_height * entry->memory_stride;
+    FlushEFBCopy(entry);
+
+    // The later copies were made after this one, so writing it to RAM doesn't make them outdated.
+    for (size_t j = i + 1; j < m_pending_efb_copies.size(); j++)
+    {
+      TCacheEntry* later_entry = m_pending_efb_copies[j].get();
+      const u32 later_size = later_entry->pending_efb_copy_height * later_entry->memory_stride;
+      if (later_entry->addr < address + size && address < later_entry->addr + later_size)
+      {
+        later_entry->pending_efb_copy_write_generation =
+            memory.GetRangeWriteGeneration(later_entry->addr, later_size);
+        later_entry->pending_efb_copy_memory_hash = later_entry->CalculateHash();
+      }
+    }
+  }
+  m_pending_efb_copies.erase(m_pending_efb_copies.begin(),
+                             m_pending_efb_copies.begin() + count);
+}
+
+void TextureCacheBase::FlushDueEFBCopies()
+{
+  const int latency = g_ActiveConfig.iEFBCopyReadbackLatency;
+  if (latency <= 0)
+  {
+    FlushEFBCopies();
+    return;
+  }
+
+  // Copies are pending in the order they were made, so the ones which are due form a prefix.
+  const int frame = g_presenter->FrameCount();
+  size_t count = 0;
+  if (m_pending_efb_copies.size() > MAX_LATENT_EFB_COPIES)
+    count = m_pending_efb_copies.size() - MAX_LATENT_EFB_COPIES;
+  while (count < m_pending_efb_copies.size() &&
+         frame - m_pending_efb_copies[count]->pending_efb_copy_frame >= latency)
+  {
+    count++;
+  }
+  FlushEFBCopies(count);
+}
+
+void TextureCacheBase::FlushEFBCopiesForRead(u32 address, u32 size, u32 width, u32 height)
+{
+  // Without a readback latency, copies are flushed before the guest could make the GPU read them.
+  if (g_ActiveConfig.iEFBCopyReadbackLatency <= 0)
+    return;
+
+  // Flush up to the last overlapping copy, to keep the order in which copies are written to RAM.
+  size_t count = 0;
+  for (size_t i = 0; i < m_pending_efb_copies.size(); i++)
+  {
+    const TCacheEntry* entry = m_pending_efb_copies[i].get();
+    if (!entry->invalidated && entry->addr == address && entry->native_width == width &&
+        entry->native_height == height && !entry->may_have_overlapping_textures)
+    {
+      continue;
+    }
+
+    const u32 copy_size = entry->pending_efb_copy_height * entry->memory_stride;
+    if (entry->addr < address + size && address < entry->addr + copy_size)
+      count = i + 1;
+  }
+  FlushEFBCopies(count);
 }
 
 void TextureCacheBase::FlushStaleBinds()
@@ -2597,9 +2851,27 @@ void TextureCacheBase::FlushEFBCopy(TCacheEntry* entry)
   // Copy from texture -> guest memory.
   auto& system = Core::System::GetInstance();
   auto& memory = system.GetMemory();
+  const u32 size = entry->pending_efb_copy_height * entry->memory_stride;
+
+  // The guest may have written to the destination (with the CPU or by DMA) since the copy was made,
+  // and that newer data must not be overwritten. Write generations are only tracked per page, so
+  // confirm with the contents that the write actually touched the destination. The JITs don't
+  // advance the generations on CPU writes, so the contents always have to be compared with them.
+  // The copy is then discarded, and the entry keeps the hash from before the copy, so that it gets
+  // reloaded from RAM when it's used again.
+  const bool maybe_written = !memory.AreCPUWritesTracked() ||
+                             memory.GetRangeWriteGeneration(entry->addr, size) !=
+                                 entry->pending_efb_copy_write_generation;
+  if (maybe_written && entry->CalculateHash() != entry->pending_efb_copy_memory_hash)
+  {
+    ReleaseEFBCopyStagingTexture(std::move(entry->pending_efb_copy));
+    return;
+  }
+
   u8* const dst = memory.GetPointer(entry->addr);
   WriteEFBCopyToRAM(dst, entry->pending_efb_copy_width, entry->pending_efb_copy_height,
                     entry->memory_stride, std::move(entry->pending_efb_copy));
+  memory.MarkRangeWritten(entry->addr, size);
 
   // If the EFB copy was invalidated (e.g. the bloom case mentioned in InvalidateTexture), we don't
   // need to do anything more. The entry will be automatically deleted by smart pointers
@@ -3047,6 +3319,8 @@ bool TextureCacheBase::DecodeTextureOnGPU(RcTcacheEntry& entry, u32 dst_level, c
                                           u32 row_stride, const u8* palette,
                                           TLUTFormat palette_format)
 {
+  StatTimer timer(g_stats.timings.texture_decode_time);
+
   const auto* info = TextureConversionShaderTiled::GetDecodingShaderInfo(format);
   if (!info)
     return false;
@@ -3209,6 +3483,25 @@ u64 TCacheEntry::CalculateHash() const
   }
 }
 
+bool TCacheEntry::IsBaseHashCurrent()
+{
+  auto& system = Core::System::GetInstance();
+  auto& memory = system.GetMemory();
+  const u32 memory_size =
+      memory_stride == BytesPerRow() ? size_in_bytes : memory_stride * NumBlocksY();
+
+  // Read the generation before hashing, so a write racing with the hash is noticed next time.
+  const u64 write_generation = memory.GetRangeWriteGeneration(addr, memory_size);
+  if (memory.AreCPUWritesTracked() && hashed_write_generation == write_generation)
+    return true;
+
+  if (base_hash != CalculateHash())
+    return false;
+
+  hashed_write_generation = write_generation;
+  return true;
+}
+
 TextureCacheBase::TexPoolEntry::TexPoolEntry(std::unique_ptr<AbstractTexture> tex,
                                              std::unique_ptr<AbstractFramebuffer> fb)
     : texture(std::move(tex)), framebuffer(std::move(fb))
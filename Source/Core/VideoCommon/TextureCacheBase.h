@@ -9,6 +9,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -20,6 +21,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/Flag.h"
 #include "Common/MathUtil.h"
+#include "Common/ThreadPool.h"
 
 #include "VideoCommon/AbstractTexture.h"
 #include "VideoCommon/Assets/CustomAsset.h"
@@ -125,6 +127,8 @@ struct TCacheEntry
   u32 size_in_bytes = 0;
   u64 base_hash = 0;
   u64 hash = 0;  // for paletted textures, hash = base_hash ^ palette_hash
+  // Write generation of the backing memory when base_hash was last verified
+  std::optional<u64> hashed_write_generation;
   TextureAndTLUTFormat format;
   u32 memory_stride = 0;
   bool is_efb_copy = false;
@@ -164,6 +168,10 @@ struct TCacheEntry
   std::unique_ptr<AbstractStagingTexture> pending_efb_copy;
   u32 pending_efb_copy_width = 0;
   u32 pending_efb_copy_height = 0;
+  int pending_efb_copy_frame = 0;
+  // State of the destination in RAM when the copy was made, to notice newer writes to it.
+  u64 pending_efb_copy_write_generation = 0;
+  u64 pending_efb_copy_memory_hash = 0;
 
   std::string texture_info_name = "";
 
@@ -197,6 +205,7 @@ struct TCacheEntry
   {
     base_hash = _base_hash;
     hash = _hash;
+    hashed_write_generation.reset();
   }
 
   // This texture entry is used by the other entry as a sub-texture
@@ -228,6 +237,9 @@ struct TCacheEntry
   u32 BytesPerRow() const;
 
   u64 CalculateHash() const;
+  // Checks whether the backing memory still matches base_hash. Memory which hasn't been written to
+  // since the last check isn't hashed again, if the emulated memory system tracks all writes.
+  bool IsBaseHashCurrent();
 
   int HashSampleSize() const;
   u32 GetWidth() const { return texture->GetConfig().width; }
@@ -295,6 +307,15 @@ public:
   // Flushes all pending EFB copies to emulated RAM.
   void FlushEFBCopies();
 
+  // Called when the guest waits for the GPU. Flushes the pending EFB copies, except for those
+  // which are allowed to stay pending for a few more frames by the readback latency setting.
+  void FlushDueEFBCopies();
+
+  // Flushes the pending EFB copies overlapping a range of guest RAM which the GPU is about to
+  // read. Copies which will be used from VRAM instead, as they are at the same address and of the
+  // same size, are left pending. Reads which aren't of a texture pass a width and height of 0.
+  void FlushEFBCopiesForRead(u32 address, u32 size, u32 width, u32 height);
+
   // Flush any Bound textures that can't be reused
   void FlushStaleBinds();
 
@@ -339,6 +360,18 @@ private:
 
   using TexPool = std::unordered_multimap<TextureConfig, TexPoolEntry>;
 
+  // A texture level which is decoded on the CPU into m_temp before it is uploaded.
+  struct CPUDecodeLevel
+  {
+    u32 level;
+    const u8* src;
+    u8* dst;
+    u32 raw_width;
+    u32 raw_height;
+    u32 expanded_width;
+    u32 expanded_height;
+  };
+
   static bool DidLinkedAssetsChange(const TCacheEntry& entry);
 
   TCacheEntry* LoadImpl(const TextureInfo& texture_info, bool force_reload);
@@ -353,6 +386,9 @@ private:
                      std::vector<std::shared_ptr<VideoCommon::CustomTextureData>> assets_data,
                      bool custom_arbitrary_mipmaps, bool skip_texture_dump);
 
+  void DecodeLevelsOnCPU(const TextureInfo& texture_info, u32 bytes_per_block,
+                         std::span<const CPUDecodeLevel> levels);
+
   RcTcacheEntry GetXFBFromCache(u32 address, u32 width, u32 height, u32 stride);
 
   RcTcacheEntry ApplyPaletteToEntry(RcTcacheEntry& entry, const u8* palette, TLUTFormat tlutfmt);
@@ -367,6 +403,11 @@ private:
                    bool is_arbitrary);
   void CheckTempSize(size_t required_size);
 
+  // Evicts the least recently used textures, starting with the unused ones in the pool, until the
+  // textures held by the cache and the pool fit into the configured memory budget. Textures used
+  // in the current frame and EFB copies, which only exist on the host GPU, are never evicted.
+  void EnforceMemoryBudget(int frame_count);
+
   RcTcacheEntry AllocateCacheEntry(const TextureConfig& config);
   std::optional<TexPoolEntry> AllocateTexture(const TextureConfig& config);
   TexPool::iterator FindMatchingTextureFromPool(const TextureConfig& config);
@@ -395,6 +436,9 @@ private:
                          std::unique_ptr<AbstractStagingTexture> staging_texture);
   void FlushEFBCopy(TCacheEntry* entry);
 
+  // Flushes the first count pending EFB copies, waiting for the GPU only once.
+  void FlushEFBCopies(size_t count);
+
   // Returns a staging texture of the maximum EFB copy size.
   std::unique_ptr<AbstractStagingTexture> GetEFBCopyStagingTexture();
 
@@ -454,11 +498,19 @@ private:
   // It's valid for textures to live be in here after they've been invalidated
   std::vector<RcTcacheEntry> m_pending_efb_copies;
 
+  // Maximum number of EFB copies kept pending across frames with a readback latency, which
+  // bounds the number of staging textures in use.
+  static constexpr size_t MAX_LATENT_EFB_COPIES = 64;
+
   // Staging texture used for readbacks.
   // We store this in the class so that the same staging texture can be used for multiple
   // readbacks, saving the overhead of allocating a new buffer every time.
   std::unique_ptr<AbstractStagingTexture> m_readback_texture;
 
+  // Workers which decode texture levels on the CPU alongside the GPU thread.
+  Common::ThreadPool m_decode_pool;
+  std::vector<CPUDecodeLevel> m_cpu_decode_levels;
+
   void OnFrameEnd();
 
   Common::EventHook m_frame_event =
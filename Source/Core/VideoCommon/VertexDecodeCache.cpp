@@ -0,0 +1,152 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "VideoCommon/VertexDecodeCache.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <xxhash.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Hash.h"
+#include "Common/Swap.h"
+
+#include "VideoCommon/CPMemory.h"
+#include "VideoCommon/VertexLoaderBase.h"
+#include "VideoCommon/VertexLoaderManager.h"
+
+static u64 CombineHash(u64 hash, u64 value)
+{
+  return (hash ^ value) * 0x100000001B3ULL;
+}
+
+std::optional<VertexDecodeCache::Key>
+VertexDecodeCache::GetKey(const VertexLoaderBase* loader, const u8* src, int count) const
+{
+  const u32 vertex_size = loader->m_vertex_size;
+  const u32 src_size = count * vertex_size;
+  Key key{Common::GetHash64(src, src_size, 0), XXH64(src, src_size, 0)};
+  key.hash = CombineHash(key.hash, reinterpret_cast<uintptr_t>(loader));
+  key.hash = CombineHash(key.hash, static_cast<u64>(count));
+
+  for (const VertexLoaderBase::IndexedArray& indexed : loader->m_indexed_arrays)
+  {
+    // A position index of all ones skips the vertex, and doesn't read the array.
+    const u32 skip_index = indexed.array == CPArray::Position ?
+                               (indexed.index_size == 2 ? 0xFFFF : 0xFF) :
+                               0x10000;
+    u32 min_index = 0xFFFF;
+    u32 max_index = 0;
+    bool any_index = false;
+    const u8* index_ptr = src + indexed.offset;
+    for (int i = 0; i < count; i++, index_ptr += vertex_size)
+    {
+      const u32 index = indexed.index_size == 2 ? Common::swap16(index_ptr) : *index_ptr;
+      if (index == skip_index)
+        continue;
+
+      min_index = std::min(min_index, index);
+      max_index = std::max(max_index, index);
+      any_index = true;
+    }
+    if (!any_index)
+      continue;
+
+    const u8* base = VertexLoaderManager::cached_arraybases[indexed.array];
+    if (!base)
+      return std::nullopt;
+
+    // Only hash the bytes between the first and the last element the loader reads.
+    const u32 stride = g_main_cp_state.array_strides[indexed.array];
+    const u8* start = base + min_index * stride + indexed.element_offset;
+    const u32 size = (max_index - min_index) * stride + indexed.element_size;
+    key.hash = CombineHash(key.hash, stride);
+    key.hash = CombineHash(key.hash, min_index);
+    key.hash = CombineHash(key.hash, Common::GetHash64(start, size, 0));
+    key.check = XXH64(start, size, key.check);
+  }
+
+  return key;
+}
+
+int VertexDecodeCache::Load(const Key& key, VertexLoaderBase* loader, const u8* src, u8* dst,
+                            int count)
+{
+  const auto iter = m_entries.find(key.hash);
+  if (iter == m_entries.end())
+    return -1;
+
+  Entry& entry = iter->second;
+  if (entry.data.empty() || entry.check != key.check || entry.loader != loader ||
+      entry.count != count)
+  {
+    return -1;
+  }
+
+  entry.last_used_frame = m_frame;
+  std::memcpy(dst, entry.data.data(), entry.data.size());
+
+  // The loaders also record the last vertices for zfreeze and emboss texgens. Run the last three
+  // through the loader again, so those end up exactly as if the whole draw had been decoded.
+  constexpr int ZFREEZE_VERTICES = 3;
+  const u32 stride = loader->m_native_vtx_decl.stride;
+  m_scratch.resize(stride * ZFREEZE_VERTICES + 16);
+  loader->RunVertices(src + (count - ZFREEZE_VERTICES) * loader->m_vertex_size, m_scratch.data(),
+                      ZFREEZE_VERTICES);
+  loader->m_numLoadedVertices += count - ZFREEZE_VERTICES;
+
+  return entry.num_vertices;
+}
+
+void VertexDecodeCache::Store(const Key& key, const VertexLoaderBase* loader, const u8* data,
+                              int num_vertices, int count)
+{
+  const auto [iter, inserted] = m_entries.try_emplace(key.hash);
+  Entry& entry = iter->second;
+  entry.last_used_frame = m_frame;
+  if (inserted || entry.check != key.check || entry.loader != loader || entry.count != count)
+  {
+    // Either a new draw, or one which collides with a different draw. Treat both as new.
+    m_size -= entry.data.size();
+    entry.data.clear();
+    entry.check = key.check;
+    entry.loader = loader;
+    entry.count = count;
+    return;
+  }
+
+  const size_t size = static_cast<size_t>(num_vertices) * loader->m_native_vtx_decl.stride;
+  if (!entry.data.empty() || m_size + size > MAX_SIZE)
+    return;
+
+  entry.data.assign(data, data + size);
+  entry.num_vertices = num_vertices;
+  m_size += size;
+}
+
+void VertexDecodeCache::Clear()
+{
+  m_entries.clear();
+  m_size = 0;
+}
+
+void VertexDecodeCache::OnFrameEnd()
+{
+  m_frame++;
+  if (m_frame % FRAMES_TO_KEEP != 0)
+    return;
+
+  for (auto iter = m_entries.begin(); iter != m_entries.end();)
+  {
+    if (m_frame - iter->second.last_used_frame > FRAMES_TO_KEEP)
+    {
+      m_size -= iter->second.data.size();
+      iter = m_entries.erase(iter);
+    }
+    else
+    {
+      ++iter;
+    }
+  }
+}
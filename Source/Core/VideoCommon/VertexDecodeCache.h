@@ -0,0 +1,73 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/HookableEvent.h"
+
+#include "VideoCommon/VideoEvents.h"
+
+class VertexLoaderBase;
+
+// Keeps the native vertex data produced by the vertex loaders for draws which are repeated with
+// identical input, such as static level geometry drawn every frame. Entries are keyed by a hash of
+// the raw vertex data and of the parts of the vertex arrays the draw reads, the same way the
+// texture cache detects changes to guest memory. Modified data simply produces a different key,
+// and entries which are no longer used age out.
+class VertexDecodeCache
+{
+public:
+  // Smaller draws are cheaper to decode than to hash.
+  static constexpr int MIN_VERTICES = 64;
+  static constexpr size_t MAX_SIZE = 64 * 1024 * 1024;
+  static constexpr u64 FRAMES_TO_KEEP = 60;
+
+  struct Key
+  {
+    u64 hash;
+    // A second, independent hash of the same data, so that a collision of the first one doesn't
+    // return the vertices of a different draw.
+    u64 check;
+  };
+
+  // Returns the key identifying a draw, or nothing if the draw can't be cached.
+  std::optional<Key> GetKey(const VertexLoaderBase* loader, const u8* src, int count) const;
+
+  // Copies the output of an earlier identical draw to dst and returns its vertex count, or returns
+  // -1 if there is none.
+  int Load(const Key& key, VertexLoaderBase* loader, const u8* src, u8* dst, int count);
+
+  // Remembers the output of a draw. Draws seen for the first time are only noted, and their data
+  // is kept once they are drawn again, so one-off dynamic geometry doesn't fill up the cache.
+  void Store(const Key& key, const VertexLoaderBase* loader, const u8* data, int num_vertices,
+             int count);
+
+  void Clear();
+
+private:
+  struct Entry
+  {
+    std::vector<u8> data;
+    u64 check;
+    const VertexLoaderBase* loader;
+    int count;
+    int num_vertices;
+    u64 last_used_frame;
+  };
+
+  void OnFrameEnd();
+
+  std::unordered_map<u64, Entry> m_entries;
+  std::vector<u8> m_scratch;
+  size_t m_size = 0;
+  u64 m_frame = 0;
+
+  Common::EventHook m_frame_event =
+      AfterFrameEvent::Register([this] { OnFrameEnd(); }, "VertexDecodeCache");
+};
@@ -523,5 +523,10 @@ void VertexLoaderARM64::GenerateVertexLoader()
 int VertexLoaderARM64::RunVertices(const u8* src, u8* dst, int count)
 {
   m_numLoadedVertices += count;
+  return RunVerticesConcurrent(src, dst, count);
+}
+
+int VertexLoaderARM64::RunVerticesConcurrent(const u8* src, u8* dst, int count)
+{
   return ((int (*)(const u8* src, u8* dst, int count))region)(src, dst, count - 1);
 }
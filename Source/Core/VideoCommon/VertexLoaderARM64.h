@@ -21,6 +21,8 @@ public:
 
 protected:
   int RunVertices(const u8* src, u8* dst, int count) override;
+  bool SupportsConcurrentLoading() const override { return true; }
+  int RunVerticesConcurrent(const u8* src, u8* dst, int count) override;
 
 private:
   u32 m_src_ofs = 0;
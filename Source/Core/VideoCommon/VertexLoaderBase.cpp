@@ -224,6 +224,92 @@ u32 VertexLoaderBase::GetVertexComponents(const TVtxDesc& vtx_desc, const VAT& v
   return components;
 }
 
+std::vector<VertexLoaderBase::IndexedArray>
+VertexLoaderBase::GetIndexedArrays(const TVtxDesc& vtx_desc, const VAT& vtx_attr)
+{
+  std::vector<IndexedArray> arrays;
+
+  // Matrix indices come first, and are never indexed
+  u32 offset = std::popcount(vtx_desc.low.Hex & 0x1FF);
+
+  const auto add = [&](CPArray array, VertexComponentFormat format, u32 element_size,
+                       u32 num_indices = 1) {
+    const u32 index_size = format == VertexComponentFormat::Index16 ? 2 : 1;
+    for (u32 i = 0; i < num_indices; i++)
+    {
+      // With several indices, each one reads the next part of the element
+      arrays.push_back({array, static_cast<u8>(offset), static_cast<u8>(index_size),
+                        static_cast<u8>(i * element_size), static_cast<u8>(element_size)});
+      offset += index_size;
+    }
+  };
+
+  const VertexComponentFormat position = vtx_desc.low.Position;
+  if (IsIndexed(position))
+  {
+    add(CPArray::Position, position,
+        VertexLoader_Position::GetSize(VertexComponentFormat::Direct, vtx_attr.g0.PosFormat,
+                                       vtx_attr.g0.PosElements));
+  }
+  else
+  {
+    offset += VertexLoader_Position::GetSize(position, vtx_attr.g0.PosFormat,
+                                             vtx_attr.g0.PosElements);
+  }
+
+  const VertexComponentFormat normal = vtx_desc.low.Normal;
+  if (IsIndexed(normal))
+  {
+    // With NormalIndex3, the normal, tangent and binormal each have their own index, which only
+    // reads that one vector
+    const bool index3 =
+        vtx_attr.g0.NormalIndex3 && vtx_attr.g0.NormalElements == NormalComponentCount::NTB;
+    const NormalComponentCount elements =
+        index3 ? NormalComponentCount::N : vtx_attr.g0.NormalElements.Value();
+    add(CPArray::Normal, normal,
+        VertexLoader_Normal::GetSize(VertexComponentFormat::Direct, vtx_attr.g0.NormalFormat,
+                                     elements, false),
+        index3 ? 3 : 1);
+  }
+  else
+  {
+    offset += VertexLoader_Normal::GetSize(normal, vtx_attr.g0.NormalFormat,
+                                           vtx_attr.g0.NormalElements, vtx_attr.g0.NormalIndex3);
+  }
+
+  for (u8 i = 0; i < vtx_desc.low.Color.Size(); i++)
+  {
+    const VertexComponentFormat color = vtx_desc.low.Color[i];
+    if (IsIndexed(color))
+    {
+      add(CPArray::Color0 + i, color,
+          VertexLoader_Color::GetSize(VertexComponentFormat::Direct, vtx_attr.GetColorFormat(i)));
+    }
+    else
+    {
+      offset += VertexLoader_Color::GetSize(color, vtx_attr.GetColorFormat(i));
+    }
+  }
+
+  for (u8 i = 0; i < vtx_desc.high.TexCoord.Size(); i++)
+  {
+    const VertexComponentFormat tex_coord = vtx_desc.high.TexCoord[i];
+    if (IsIndexed(tex_coord))
+    {
+      add(CPArray::TexCoord0 + i, tex_coord,
+          VertexLoader_TextCoord::GetSize(VertexComponentFormat::Direct, vtx_attr.GetTexFormat(i),
+                                          vtx_attr.GetTexElements(i)));
+    }
+    else
+    {
+      offset += VertexLoader_TextCoord::GetSize(tex_coord, vtx_attr.GetTexFormat(i),
+                                                vtx_attr.GetTexElements(i));
+    }
+  }
+
+  return arrays;
+}
+
 std::unique_ptr<VertexLoaderBase> VertexLoaderBase::CreateVertexLoader(const TVtxDesc& vtx_desc,
                                                                        const VAT& vtx_attr)
 {
@@ -58,17 +58,38 @@ struct hash<VertexLoaderUID>
 class VertexLoaderBase
 {
 public:
+  // An attribute which is loaded through an index into one of the vertex arrays.
+  struct IndexedArray
+  {
+    CPArray array;
+    u8 offset;          // Offset of the index within the raw GC vertex
+    u8 index_size;      // 1 or 2 bytes
+    u8 element_offset;  // Offset of the data read for each index within an array element
+    u8 element_size;    // Number of bytes read from the array for each index
+  };
+
   static u32 GetVertexSize(const TVtxDesc& vtx_desc, const VAT& vtx_attr);
   static u32 GetVertexComponents(const TVtxDesc& vtx_desc, const VAT& vtx_attr);
+  static std::vector<IndexedArray> GetIndexedArrays(const TVtxDesc& vtx_desc, const VAT& vtx_attr);
   static std::unique_ptr<VertexLoaderBase> CreateVertexLoader(const TVtxDesc& vtx_desc,
                                                               const VAT& vtx_attr);
   virtual ~VertexLoaderBase() {}
   virtual int RunVertices(const u8* src, u8* dst, int count) = 0;
 
+  // Loaders that keep no per-call state in the loader object can decode disjoint ranges of the
+  // same draw on several threads at once through RunVerticesConcurrent(). Unlike RunVertices(),
+  // it does not update m_numLoadedVertices.
+  virtual bool SupportsConcurrentLoading() const { return false; }
+  virtual int RunVerticesConcurrent(const u8* src, u8* dst, int count)
+  {
+    return RunVertices(src, dst, count);
+  }
+
   // per loader public state
   PortableVertexDeclaration m_native_vtx_decl{};
   const u32 m_vertex_size;  // number of bytes of a raw GC vertex
   const u32 m_native_components;
+  const std::vector<IndexedArray> m_indexed_arrays;
 
   // used by VertexLoaderManager
   NativeVertexFormat* m_native_vertex_format = nullptr;
@@ -78,7 +99,8 @@ protected:
   VertexLoaderBase(const TVtxDesc& vtx_desc, const VAT& vtx_attr)
       : m_vertex_size{GetVertexSize(vtx_desc, vtx_attr)}, m_native_components{GetVertexComponents(
                                                               vtx_desc, vtx_attr)},
-        m_VtxAttr{vtx_attr}, m_VtxDesc{vtx_desc}
+        m_indexed_arrays{GetIndexedArrays(vtx_desc, vtx_attr)}, m_VtxAttr{vtx_attr},
+        m_VtxDesc{vtx_desc}
   {
   }
 
@@ -4,18 +4,23 @@
 #include "VideoCommon/VertexLoaderManager.h"
 
 #include <algorithm>
+#include <cstring>
 #include <iterator>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "Common/Assert.h"
 #include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
+#include "Common/FPURoundMode.h"
 #include "Common/Logging/Log.h"
+#include "Common/ThreadPool.h"
 
 #include "Core/DolphinAnalytics.h"
 #include "Core/HW/Memmap.h"
@@ -28,6 +33,7 @@
 #include "VideoCommon/IndexGenerator.h"
 #include "VideoCommon/NativeVertexFormat.h"
 #include "VideoCommon/Statistics.h"
+#include "VideoCommon/VertexDecodeCache.h"
 #include "VideoCommon/VertexLoaderBase.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VertexShaderManager.h"
@@ -61,6 +67,10 @@ std::array<VertexLoaderBase*, CP_NUM_VAT_REG> g_main_vertex_loaders;
 std::array<VertexLoaderBase*, CP_NUM_VAT_REG> g_preprocess_vertex_loaders;
 bool g_needs_cp_xf_consistency_check;
 
+// Workers for decoding large draws, started on demand from the GPU thread.
+static Common::ThreadPool s_vertex_loader_pool;
+static std::unique_ptr<VertexDecodeCache> s_decode_cache;
+
 void Init()
 {
   MarkAllDirty();
@@ -69,10 +79,14 @@ void Init()
   for (auto& map_entry : g_preprocess_vertex_loaders)
     map_entry = nullptr;
   SETSTAT(g_stats.num_vertex_loaders, 0);
+  s_decode_cache = std::make_unique<VertexDecodeCache>();
 }
 
 void Clear()
 {
+  s_vertex_loader_pool.Shutdown();
+  s_decode_cache.reset();
+
   std::lock_guard<std::mutex> lk(s_vertex_loader_map_lock);
   s_vertex_loader_map.clear();
   s_native_vertex_map.clear();
@@ -333,6 +347,118 @@ static void CheckCPConfiguration(int vtx_attr_group)
   }
 }
 
+int RunVerticesInRanges(Common::ThreadPool& pool, VertexLoaderBase* loader, const u8* src,
+                        u8* dst, int count, u32 num_ranges)
+{
+  // The vertex loaders can write up to 4 bytes past the end of their output.
+  constexpr u32 OUTPUT_PADDING = 16;
+
+  struct RangeResult
+  {
+    int first_count;
+    int rest_count;
+  };
+
+  const u32 src_stride = loader->m_vertex_size;
+  const u32 dst_stride = loader->m_native_vtx_decl.stride;
+  const int range_size = count / static_cast<int>(num_ranges);
+  const u32 scratch_stride = dst_stride + OUTPUT_PADDING;
+  ASSERT(num_ranges >= 2 && range_size >= 3);
+
+  // A range writing past its end would clobber the first vertex of the next range, which may
+  // already have been written by another thread. So every range after the first decodes its
+  // first vertex into a scratch buffer, and it gets moved into place once all ranges are done.
+  static std::vector<u8> s_scratch;
+  s_scratch.resize(scratch_stride * num_ranges);
+  std::vector<RangeResult> results(num_ranges - 1);
+
+  pool.ParallelFor(num_ranges - 1, [&](u32 i) {
+    Common::FPU::LoadDefaultSIMDState();
+
+    const int start = static_cast<int>(i) * range_size;
+    const u8* range_src = src + start * src_stride;
+    u8* range_dst = dst + start * dst_stride;
+    if (i == 0)
+    {
+      results[i] = {0, loader->RunVerticesConcurrent(range_src, range_dst, range_size)};
+      return;
+    }
+
+    results[i].first_count =
+        loader->RunVerticesConcurrent(range_src, &s_scratch[i * scratch_stride], 1);
+    results[i].rest_count = loader->RunVerticesConcurrent(
+        range_src + src_stride, range_dst + dst_stride, range_size - 1);
+  });
+
+  // Stitch the ranges together. Ranges only ever move towards the start of the buffer, when
+  // vertices were skipped, so the first vertex never overwrites data which is still needed.
+  u8* write_ptr = dst;
+  for (u32 i = 0; i < num_ranges - 1; i++)
+  {
+    const RangeResult& result = results[i];
+    if (result.first_count != 0)
+    {
+      std::memcpy(write_ptr, &s_scratch[i * scratch_stride], dst_stride);
+      write_ptr += dst_stride;
+    }
+
+    const int rest_start = static_cast<int>(i) * range_size + (i != 0 ? 1 : 0);
+    const u8* rest_ptr = dst + rest_start * dst_stride;
+    const size_t rest_size = static_cast<size_t>(result.rest_count) * dst_stride;
+    if (rest_ptr != write_ptr)
+      std::memmove(write_ptr, rest_ptr, rest_size);
+    write_ptr += rest_size;
+  }
+
+  // The last range runs alone, so the position and tangent caches used for zfreeze end up with
+  // the values from the end of the draw, just as if it had been decoded in one go.
+  const int last_start = static_cast<int>(num_ranges - 1) * range_size;
+  const int last_count =
+      loader->RunVerticesConcurrent(src + last_start * src_stride, write_ptr, count - last_start);
+
+  return static_cast<int>((write_ptr - dst) / dst_stride) + last_count;
+}
+
+static int DecodeVertices(VertexLoaderBase* loader, const u8* src, u8* dst, int count)
+{
+  const u32 num_threads = g_ActiveConfig.GetVertexLoaderThreads();
+  if (num_threads == 0 || count < MIN_VERTICES_PER_PARALLEL_RANGE * 2 ||
+      !loader->SupportsConcurrentLoading())
+  {
+    return loader->RunVertices(src, dst, count);
+  }
+
+  if (s_vertex_loader_pool.GetThreadCount() != num_threads)
+    s_vertex_loader_pool.Reset("Vertex Loader", num_threads);
+
+  // The calling thread decodes a range as well.
+  const u32 num_ranges =
+      std::min(num_threads + 1, static_cast<u32>(count / MIN_VERTICES_PER_PARALLEL_RANGE));
+  loader->m_numLoadedVertices += count;
+  return RunVerticesInRanges(s_vertex_loader_pool, loader, src, dst, count, num_ranges);
+}
+
+static int RunVerticesOnLoader(VertexLoaderBase* loader, const u8* src, u8* dst, int count)
+{
+  std::optional<VertexDecodeCache::Key> cache_key;
+  if (g_ActiveConfig.bVertexDecodeCache && count >= VertexDecodeCache::MIN_VERTICES)
+  {
+    cache_key = s_decode_cache->GetKey(loader, src, count);
+    if (cache_key)
+    {
+      const int cached_count = s_decode_cache->Load(*cache_key, loader, src, dst, count);
+      if (cached_count >= 0)
+        return cached_count;
+    }
+  }
+
+  const int num_vertices = DecodeVertices(loader, src, dst, count);
+  if (cache_key)
+    s_decode_cache->Store(*cache_key, loader, dst, num_vertices, count);
+
+  return num_vertices;
+}
+
 template <bool IsPreprocess>
 int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count, const u8* src)
 {
@@ -385,7 +511,10 @@ int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int coun
     DataReader dst = g_vertex_manager->PrepareForAdditionalData(primitive, count, stride,
                                                                 cullall || can_cpu_cull);
 
-    count = loader->RunVertices(src, dst.GetPointer(), count);
+    {
+      StatTimer timer(g_stats.timings.vertex_loader_time);
+      count = RunVerticesOnLoader(loader, src, dst.GetPointer(), count);
+    }
 
     if (can_cpu_cull && !cullall)
     {
@@ -14,6 +14,12 @@
 
 class NativeVertexFormat;
 struct PortableVertexDeclaration;
+class VertexLoaderBase;
+
+namespace Common
+{
+class ThreadPool;
+}
 
 namespace OpcodeDecoder
 {
@@ -44,6 +50,17 @@ NativeVertexFormat* GetUberVertexFormat(const PortableVertexDeclaration& decl);
 template <bool IsPreprocess = false>
 int RunVertices(int vtx_attr_group, OpcodeDecoder::Primitive primitive, int count, const u8* src);
 
+// Draws with at least this many vertices per available thread are split into ranges which are
+// decoded concurrently, if the loader supports it.
+constexpr int MIN_VERTICES_PER_PARALLEL_RANGE = 2048;
+
+// Decodes count vertices into dst, splitting them into num_ranges ranges which are decoded on the
+// threads of pool. The output (including the return value) is identical to a single call to
+// loader->RunVertices(), and so are the zfreeze caches, as the last range is decoded after all
+// other ranges have finished. Each range must contain at least 3 vertices.
+int RunVerticesInRanges(Common::ThreadPool& pool, VertexLoaderBase* loader, const u8* src,
+                        u8* dst, int count, u32 num_ranges);
+
 namespace detail
 {
 // This will look for an existing loader in the global hashmap or create a new one if there is none.
@@ -589,6 +589,11 @@ void VertexLoaderX64::GenerateVertexLoader()
 int VertexLoaderX64::RunVertices(const u8* src, u8* dst, int count)
 {
   m_numLoadedVertices += count;
+  return RunVerticesConcurrent(src, dst, count);
+}
+
+int VertexLoaderX64::RunVerticesConcurrent(const u8* src, u8* dst, int count)
+{
   return ((int (*)(const u8* src, u8* dst, int count, const void* base))region)(src, dst, count,
                                                                                 memory_base_ptr);
 }
@@ -382,6 +382,7 @@ bool VideoBackendBase::InitializeShared(std::unique_ptr<AbstractGfx> gfx,
   system.GetPixelEngine().Init(system);
   BPInit();
   VertexLoaderManager::Init();
+  OpcodeDecoder::Init();
   system.GetVertexShaderManager().Init();
   system.GetGeometryShaderManager().Init();
   system.GetPixelShaderManager().Init();
@@ -421,5 +422,6 @@ void VideoBackendBase::ShutdownShared()
 
   auto& system = Core::System::GetInstance();
   VertexLoaderManager::Clear();
+  OpcodeDecoder::Shutdown();
   system.GetFifo().Shutdown();
 }
@@ -113,6 +113,7 @@ void VideoConfig::Refresh()
   bDumpBaseTextures = Config::Get(Config::GFX_DUMP_BASE_TEXTURES);
   bHiresTextures = Config::Get(Config::GFX_HIRES_TEXTURES);
   bCacheHiresTextures = Config::Get(Config::GFX_CACHE_HIRES_TEXTURES);
+  bPrefetchHiresTextures = Config::Get(Config::GFX_PREFETCH_HIRES_TEXTURES);
   bDumpEFBTarget = Config::Get(Config::GFX_DUMP_EFB_TARGET);
   bDumpXFBTarget = Config::Get(Config::GFX_DUMP_XFB_TARGET);
   bDumpFramesAsImages = Config::Get(Config::GFX_DUMP_FRAMES_AS_IMAGES);
@@ -144,7 +145,13 @@ void VideoConfig::Refresh()
   iShaderCompilationMode = Config::Get(Config::GFX_SHADER_COMPILATION_MODE);
   iShaderCompilerThreads = Config::Get(Config::GFX_SHADER_COMPILER_THREADS);
   iShaderPrecompilerThreads = Config::Get(Config::GFX_SHADER_PRECOMPILER_THREADS);
+  bPrewarmSharedPipelines = Config::Get(Config::GFX_PREWARM_SHARED_PIPELINES);
   bCPUCull = Config::Get(Config::GFX_CPU_CULL);
+  iVertexLoaderThreads = Config::Get(Config::GFX_VERTEX_LOADER_THREADS);
+  bVertexDecodeCache = Config::Get(Config::GFX_VERTEX_DECODE_CACHE);
+  bDisplayListCache = Config::Get(Config::GFX_DISPLAY_LIST_CACHE);
+  iTextureCacheBudget = Config::Get(Config::GFX_TEXTURE_CACHE_BUDGET);
+  iTextureDecodingThreads = Config::Get(Config::GFX_TEXTURE_DECODING_THREADS);
 
   texture_filtering_mode = Config::Get(Config::GFX_ENHANCE_FORCE_TEXTURE_FILTERING);
   iMaxAnisotropy = Config::Get(Config::GFX_ENHANCE_MAX_ANISOTROPY);
@@ -181,6 +188,7 @@ void VideoConfig::Refresh()
   bSkipXFBCopyToRam = Config::Get(Config::GFX_HACK_SKIP_XFB_COPY_TO_RAM);
   bDisableCopyToVRAM = Config::Get(Config::GFX_HACK_DISABLE_COPY_TO_VRAM);
   bDeferEFBCopies = Config::Get(Config::GFX_HACK_DEFER_EFB_COPIES);
+  iEFBCopyReadbackLatency = Config::Get(Config::GFX_HACK_EFB_COPY_READBACK_LATENCY);
   bImmediateXFB = Config::Get(Config::GFX_HACK_IMMEDIATE_XFB);
   bVISkip = Config::Get(Config::GFX_HACK_VI_SKIP);
   bSkipPresentingDuplicateXFBs = bVISkip || Config::Get(Config::GFX_HACK_SKIP_DUPLICATE_XFBS);
@@ -271,6 +279,23 @@ u32 VideoConfig::GetShaderPrecompilerThreads() const
     return 1;
 }
 
+u32 VideoConfig::GetVertexLoaderThreads() const
+{
+  if (iVertexLoaderThreads >= 0)
+    return static_cast<u32>(iVertexLoaderThreads);
+
+  // Automatic number. The CPU and GPU threads are already busy in dual core mode.
+  return static_cast<u32>(std::clamp(cpu_info.num_cores - 3, 0, 3));
+}
+
+u32 VideoConfig::GetTextureDecodingThreads() const
+{
+  if (iTextureDecodingThreads >= 0)
+    return static_cast<u32>(iTextureDecodingThreads);
+
+  return static_cast<u32>(std::clamp(cpu_info.num_cores - 3, 0, 3));
+}
+
 void CheckForConfigChanges()
 {
   const ShaderHostConfig old_shader_host_config = ShaderHostConfig::GetCurrent();
@@ -173,6 +173,7 @@ struct VideoConfig final
   bool bDumpBaseTextures = false;
   bool bHiresTextures = false;
   bool bCacheHiresTextures = false;
+  bool bPrefetchHiresTextures = false;
   bool bDumpEFBTarget = false;
   bool bDumpXFBTarget = false;
   bool bDumpFramesAsImages = false;
@@ -198,11 +199,35 @@ struct VideoConfig final
   bool bForceProgressive = false;
   bool bCPUCull = false;
 
+  // Number of extra threads used to decode large draws.
+  // 0 decodes all vertices on the GPU thread.
+  // -1 uses an automatic number based on the CPU threads.
+  int iVertexLoaderThreads = 0;
+
+  // Reuse decoded vertices of draws repeated with identical input.
+  bool bVertexDecodeCache = false;
+
+  // Replay display lists called again with unchanged contents from their decoded commands. Only
+  // has an effect with the interpreter CPU cores, which track writes to guest memory.
+  bool bDisplayListCache = false;
+
+  // Memory in MiB which the textures of the texture cache may use before the least recently used
+  // ones are evicted. 0 disables the limit.
+  int iTextureCacheBudget = 0;
+
+  // Number of extra threads used to decode mipmapped and large textures on the CPU.
+  // 0 decodes all textures on the GPU thread.
+  // -1 uses an automatic number based on the CPU threads.
+  int iTextureDecodingThreads = 0;
+
   bool bEFBEmulateFormatChanges = false;
   bool bSkipEFBCopyToRam = false;
   bool bSkipXFBCopyToRam = false;
   bool bDisableCopyToVRAM = false;
   bool bDeferEFBCopies = false;
+  // Number of frames deferred EFB copies may stay pending before they are written to RAM, unless
+  // the GPU reads their range earlier. 0 writes them whenever the guest waits for the GPU.
+  int iEFBCopyReadbackLatency = 0;
   bool bImmediateXFB = false;
   bool bSkipPresentingDuplicateXFBs = false;
   bool bCopyEFBScaled = false;
@@ -257,6 +282,10 @@ struct VideoConfig final
   int iShaderCompilerThreads = 0;
   int iShaderPrecompilerThreads = 0;
 
+  // On the first run of a game, compile the pipelines most commonly used by other games in the
+  // background. These come from the shared pipeline UID corpus in the cache directory.
+  bool bPrewarmSharedPipelines = false;
+
   // Loading custom drivers on Android
   std::string customDriverLibraryName;
 
@@ -363,6 +392,8 @@ struct VideoConfig final
   bool UsingUberShaders() const;
   u32 GetShaderCompilerThreads() const;
   u32 GetShaderPrecompilerThreads() const;
+  u32 GetVertexLoaderThreads() const;
+  u32 GetTextureDecodingThreads() const;
 };
 
 extern VideoConfig g_Config;
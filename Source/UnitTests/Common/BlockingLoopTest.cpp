@@ -2,11 +2,13 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <atomic>
+#include <chrono>
 #include <thread>
 
 #include <gtest/gtest.h>
 
 #include "Common/BlockingLoop.h"
+#include "Common/SpinWait.h"
 
 TEST(BlockingLoop, MultiThreaded)
 {
@@ -77,3 +79,79 @@ TEST(BlockingLoop, MultiThreaded)
     loop_thread.join();
   }
 }
+
+TEST(BlockingLoop, SpinningWorker)
+{
+  Common::BlockingLoop loop;
+  std::atomic<int> signaled(0);
+  std::atomic<int> received(0);
+
+  std::thread loop_thread([&]() { loop.Run([&]() { received.store(signaled.load()); }); });
+  loop.Prepare();
+  loop.Wait();
+
+  // Waking the worker shortly after it went to sleep makes the waits short enough for it to spin.
+  // No wakeup may be lost in the handshake between a spinning worker and Wakeup(), or Wait()
+  // would block forever.
+  for (int i = 0; i < 10000; i++)
+  {
+    signaled++;
+    loop.Wakeup();
+    loop.Wait();
+    ASSERT_EQ(signaled.load(), received.load());
+
+    // Wait() only lets the worker sleep if it had to block, which it rarely does here.
+    loop.AllowSleep();
+    const auto resume = std::chrono::steady_clock::now() + std::chrono::microseconds(i % 8);
+    while (std::chrono::steady_clock::now() < resume)
+    {
+    }
+  }
+
+  loop.Stop();
+  loop_thread.join();
+}
+
+TEST(AdaptiveSpinWait, SpinConsumesSignal)
+{
+  Common::AdaptiveSpinWait spin_wait;
+
+  // A signal which the waiting thread sees while spinning must not be counted as the wakeup of a
+  // later sleep, even if the sleep ends without a new signal (e.g. because of a timeout).
+  spin_wait.OnSignal();
+  EXPECT_TRUE(spin_wait.Spin([] { return true; }));
+  EXPECT_FALSE(spin_wait.Spin([] { return false; }));
+  spin_wait.OnSleepEnd();
+
+  Common::AdaptiveSpinWait::Stats stats = spin_wait.GetStats();
+  EXPECT_EQ(1u, stats.spin_wakeups);
+  EXPECT_EQ(1u, stats.sleep_wakeups);
+  EXPECT_EQ(0u, stats.total_wakeup_latency_ns);
+
+  // The same goes for a signal which arrives after the spin has already seen the wake.
+  EXPECT_TRUE(spin_wait.Spin([] { return true; }));
+  spin_wait.OnSignal();
+  std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  EXPECT_FALSE(spin_wait.Spin([] { return false; }));
+  spin_wait.OnSleepEnd();
+
+  stats = spin_wait.GetStats();
+  EXPECT_EQ(2u, stats.sleep_wakeups);
+  EXPECT_EQ(0u, stats.total_wakeup_latency_ns);
+  EXPECT_EQ(0u, stats.max_wakeup_latency_ns);
+}
+
+TEST(AdaptiveSpinWait, SleepLatency)
+{
+  Common::AdaptiveSpinWait spin_wait;
+
+  EXPECT_FALSE(spin_wait.Spin([] { return false; }));
+  spin_wait.OnSignal();
+  std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  spin_wait.OnSleepEnd();
+
+  const Common::AdaptiveSpinWait::Stats stats = spin_wait.GetStats();
+  EXPECT_EQ(1u, stats.sleep_wakeups);
+  EXPECT_GE(stats.total_wakeup_latency_ns, 1000000u);
+  EXPECT_EQ(stats.total_wakeup_latency_ns, stats.max_wakeup_latency_ns);
+}
@@ -0,0 +1,99 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/DirectoryWatcher.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+
+class DirectoryWatcherTest : public testing::Test
+{
+protected:
+  DirectoryWatcherTest()
+      : m_directory(File::CreateTempDir()), m_watched_path(m_directory + "/watched")
+  {
+  }
+
+  ~DirectoryWatcherTest() override
+  {
+    if (!m_directory.empty())
+      File::DeleteDirRecursively(m_directory);
+  }
+
+  void SetUp() override
+  {
+    ASSERT_FALSE(m_directory.empty());
+    if (!m_watcher.IsSupported())
+      GTEST_SKIP() << "Directory watching is not supported";
+
+    ASSERT_TRUE(File::CreateDir(m_watched_path));
+    ASSERT_TRUE(m_watcher.AddDirectory(m_watched_path));
+  }
+
+  Common::DirectoryWatcher::Changes Wait()
+  {
+    return m_watcher.Wait(std::chrono::milliseconds{1000});
+  }
+
+  static bool Contains(const std::vector<std::string>& paths, const std::string& path)
+  {
+    return std::find(paths.begin(), paths.end(), path) != paths.end();
+  }
+
+  const std::string m_directory;
+  const std::string m_watched_path;
+  Common::DirectoryWatcher m_watcher;
+};
+
+TEST_F(DirectoryWatcherTest, FileChanges)
+{
+  {
+    File::IOFile file(m_watched_path + "/file.txt", "wb");
+    ASSERT_TRUE(file.WriteString("data"));
+  }
+
+  const auto changes = Wait();
+  EXPECT_FALSE(changes.overflowed);
+  EXPECT_TRUE(Contains(changes.paths, m_watched_path + "/file.txt"));
+  EXPECT_TRUE(changes.directories.empty());
+}
+
+TEST_F(DirectoryWatcherTest, DirectoryReplaced)
+{
+  // Changes to the directory itself are reported as the directory, not as a file in its parent
+  ASSERT_TRUE(File::DeleteDir(m_watched_path));
+  ASSERT_TRUE(File::CreateDir(m_watched_path));
+
+  auto changes = Wait();
+  EXPECT_TRUE(Contains(changes.directories, m_watched_path));
+  EXPECT_FALSE(Contains(changes.paths, m_directory));
+  EXPECT_TRUE(changes.unwatched_directories.empty());
+
+  // The new directory is watched again
+  {
+    File::IOFile file(m_watched_path + "/file.txt", "wb");
+    ASSERT_TRUE(file.WriteString("data"));
+  }
+  changes = Wait();
+  EXPECT_TRUE(Contains(changes.paths, m_watched_path + "/file.txt"));
+}
+
+TEST_F(DirectoryWatcherTest, DirectoryDeleted)
+{
+  // A directory which can't be watched again is reported, so that it can be polled instead
+  ASSERT_TRUE(File::DeleteDir(m_watched_path));
+
+  const auto changes = Wait();
+  EXPECT_TRUE(Contains(changes.directories, m_watched_path));
+  EXPECT_TRUE(Contains(changes.unwatched_directories, m_watched_path));
+
+  // It can be added again once it exists
+  ASSERT_TRUE(File::CreateDir(m_watched_path));
+  EXPECT_TRUE(m_watcher.AddDirectory(m_watched_path));
+}
@@ -0,0 +1,118 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/IOUringReader.h"
+
+class IOUringReaderTest : public testing::Test
+{
+protected:
+  // Large enough for more requests than fit in the queue at once, and not a multiple of the
+  // request size.
+  static constexpr size_t FILE_SIZE = 0x20000 * 40 + 0x1234;
+
+  IOUringReaderTest()
+      : m_directory(File::CreateTempDir()), m_file_path(m_directory + "/file.bin"),
+        m_data(FILE_SIZE)
+  {
+    for (size_t i = 0; i < m_data.size(); ++i)
+      m_data[i] = static_cast<u8>(i * 7 + i / 0x1000);
+  }
+
+  ~IOUringReaderTest() override
+  {
+    if (!m_directory.empty())
+      File::DeleteDirRecursively(m_directory);
+  }
+
+  void SetUp() override
+  {
+    ASSERT_FALSE(m_directory.empty());
+    if (!m_reader.IsSupported())
+      GTEST_SKIP() << "io_uring is not supported";
+
+    File::IOFile file(m_file_path, "wb");
+    ASSERT_TRUE(file.WriteBytes(m_data.data(), m_data.size()));
+  }
+
+  // Reads the range with the reader and with a regular read, and checks that both match.
+  void TestRead(File::IOFile& file, u64 offset, size_t length)
+  {
+    std::vector<u8> expected(length);
+    ASSERT_TRUE(file.Seek(offset, File::SeekOrigin::Begin));
+    ASSERT_TRUE(file.ReadBytes(expected.data(), length));
+
+    std::vector<u8> data(length);
+    ASSERT_TRUE(m_reader.Read(file, offset, data.data(), length));
+    EXPECT_EQ(expected, data);
+  }
+
+  const std::string m_directory;
+  const std::string m_file_path;
+  std::vector<u8> m_data;
+  File::IOUringReader m_reader;
+};
+
+TEST_F(IOUringReaderTest, Read)
+{
+  File::IOFile file(m_file_path, "rb");
+  ASSERT_TRUE(file.IsOpen());
+
+  TestRead(file, 0, FILE_SIZE);
+  TestRead(file, 12345, FILE_SIZE - 12345 - 678);
+  TestRead(file, 0x20000 - 1, 0x20000 + 2);
+  TestRead(file, 0x20000 * 3, 0x20000 * 17);
+  TestRead(file, 5, 1);
+  TestRead(file, 0, 0);
+
+  // Reading doesn't move the file position
+  ASSERT_TRUE(file.Seek(100, File::SeekOrigin::Begin));
+  std::vector<u8> data(0x40000);
+  ASSERT_TRUE(m_reader.Read(file, 0, data.data(), data.size()));
+  EXPECT_EQ(100u, file.Tell());
+}
+
+TEST_F(IOUringReaderTest, EndOfFile)
+{
+  File::IOFile file(m_file_path, "rb");
+  ASSERT_TRUE(file.IsOpen());
+
+  // Up to the end of the file is fine, past it is not
+  TestRead(file, FILE_SIZE - 0x50000, 0x50000);
+  TestRead(file, FILE_SIZE - 1, 1);
+
+  std::vector<u8> data(0x50000);
+  EXPECT_FALSE(m_reader.Read(file, FILE_SIZE - 0x50000 + 1, data.data(), data.size()));
+  EXPECT_FALSE(m_reader.Read(file, FILE_SIZE, data.data(), 1));
+  EXPECT_FALSE(m_reader.Read(file, FILE_SIZE + 0x100000, data.data(), data.size()));
+
+  // The reader is still usable after a failed read
+  TestRead(file, 0, FILE_SIZE);
+}
+
+TEST_F(IOUringReaderTest, ReadUnflushedWrites)
+{
+  File::IOFile file(m_file_path, "r+b");
+  ASSERT_TRUE(file.IsOpen());
+
+  // Data which is still buffered by the C library has to be read as well
+  const std::vector<u8> new_data(0x100, 0xAB);
+  ASSERT_TRUE(file.Seek(0x30000, File::SeekOrigin::Begin));
+  ASSERT_TRUE(file.WriteBytes(new_data.data(), new_data.size()));
+
+  std::vector<u8> data(0x40000);
+  ASSERT_TRUE(m_reader.Read(file, 0x20000, data.data(), data.size()));
+  for (size_t i = 0; i < data.size(); ++i)
+  {
+    const u64 offset = 0x20000 + i;
+    const bool overwritten = offset >= 0x30000 && offset < 0x30000 + new_data.size();
+    ASSERT_EQ(overwritten ? 0xAB : m_data[offset], data[i]) << "at offset " << offset;
+  }
+}
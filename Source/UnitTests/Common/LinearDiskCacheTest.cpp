@@ -0,0 +1,140 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/LinearDiskCache.h"
+
+namespace
+{
+class Reader final : public Common::LinearDiskCacheReader<u32, u8>
+{
+public:
+  void Read(const u32& key, const u8* value, u32 value_size) override
+  {
+    values[key].assign(value, value + value_size);
+    reads++;
+  }
+
+  std::map<u32, std::vector<u8>> values;
+  u32 reads = 0;
+};
+
+class LinearDiskCacheTest : public testing::Test
+{
+protected:
+  LinearDiskCacheTest()
+      : m_directory(File::CreateTempDir()), m_path(m_directory + "/cache.bin")
+  {
+  }
+
+  ~LinearDiskCacheTest() override
+  {
+    if (!m_directory.empty())
+      File::DeleteDirRecursively(m_directory);
+  }
+
+  void SetUp() override
+  {
+    if (m_directory.empty())
+      FAIL();
+  }
+
+  void Append(u32 key, const std::vector<u8>& value)
+  {
+    m_cache.Append(key, value.data(), static_cast<u32>(value.size()));
+  }
+
+  u32 Reopen(Reader& reader)
+  {
+    m_cache.Close();
+    return m_cache.OpenAndRead(m_path, reader);
+  }
+
+  const std::string m_directory;
+  const std::string m_path;
+  Common::LinearDiskCache<u32, u8> m_cache;
+};
+}  // namespace
+
+TEST_F(LinearDiskCacheTest, ReadsAppendedEntries)
+{
+  Reader reader;
+  EXPECT_EQ(m_cache.OpenAndRead(m_path, reader), 0u);
+  Append(1, {1, 2, 3});
+  Append(2, {});
+  Append(3, {4});
+
+  Reader reopened;
+  EXPECT_EQ(Reopen(reopened), 3u);
+  EXPECT_EQ(reopened.values, (std::map<u32, std::vector<u8>>{{1, {1, 2, 3}}, {2, {}}, {3, {4}}}));
+}
+
+TEST_F(LinearDiskCacheTest, OnlyReadsLatestEntryForKey)
+{
+  Reader reader;
+  m_cache.OpenAndRead(m_path, reader);
+  Append(1, {1});
+  Append(2, {2});
+  Append(1, {3});
+
+  Reader reopened;
+  EXPECT_EQ(Reopen(reopened), 2u);
+  EXPECT_EQ(reopened.reads, 2u);
+  EXPECT_EQ(reopened.values[1], std::vector<u8>{3});
+  EXPECT_EQ(reopened.values[2], std::vector<u8>{2});
+}
+
+TEST_F(LinearDiskCacheTest, CompactsReplacedEntries)
+{
+  const std::vector<u8> large_value(1024 * 1024, 0xAB);
+
+  Reader reader;
+  m_cache.OpenAndRead(m_path, reader);
+  Append(1, large_value);
+  Append(1, large_value);
+  Append(2, {2});
+  m_cache.Sync();
+  const u64 original_size = File::GetSize(m_path);
+
+  Reader compacted;
+  EXPECT_EQ(Reopen(compacted), 2u);
+  EXPECT_LE(File::GetSize(m_path), original_size - large_value.size());
+
+  // Appends continue the numbering of the compacted file.
+  Append(3, {3});
+  Reader reopened;
+  EXPECT_EQ(Reopen(reopened), 3u);
+  EXPECT_EQ(reopened.values[1], large_value);
+  EXPECT_EQ(reopened.values[3], std::vector<u8>{3});
+}
+
+TEST_F(LinearDiskCacheTest, IgnoresTruncatedEntry)
+{
+  Reader reader;
+  m_cache.OpenAndRead(m_path, reader);
+  Append(1, {1, 2, 3});
+  Append(2, {4, 5, 6});
+  m_cache.Close();
+
+  {
+    File::IOFile file(m_path, "r+b");
+    file.Resize(file.GetSize() - 2);
+  }
+
+  Reader reopened;
+  EXPECT_EQ(m_cache.OpenAndRead(m_path, reopened), 1u);
+
+  // The truncated entry is overwritten by the next append.
+  Append(3, {7});
+  Reader appended;
+  EXPECT_EQ(Reopen(appended), 2u);
+  EXPECT_EQ(appended.values[3], std::vector<u8>{7});
+}
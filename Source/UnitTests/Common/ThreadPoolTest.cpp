@@ -0,0 +1,149 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/Event.h"
+#include "Common/ThreadPool.h"
+
+TEST(ThreadPool, PushWithoutWorkers)
+{
+  Common::ThreadPool pool;
+  EXPECT_FALSE(pool.IsRunning());
+
+  // Without workers, tasks run on the calling thread before Push returns
+  const std::thread::id caller = std::this_thread::get_id();
+  bool ran = false;
+  pool.Push([&] {
+    EXPECT_EQ(caller, std::this_thread::get_id());
+    ran = true;
+  });
+  EXPECT_TRUE(ran);
+
+  pool.WaitForCompletion();
+}
+
+TEST(ThreadPool, WaitForCompletion)
+{
+  Common::ThreadPool pool("ThreadPoolTest", 4);
+  EXPECT_EQ(4u, pool.GetThreadCount());
+
+  constexpr int TASK_COUNT = 1000;
+  std::atomic<int> counter = 0;
+  for (int i = 0; i < TASK_COUNT; ++i)
+    pool.Push([&] { counter.fetch_add(1, std::memory_order_relaxed); });
+
+  pool.WaitForCompletion();
+  EXPECT_EQ(TASK_COUNT, counter.load());
+
+  // The pool can be reused after waiting
+  pool.Push([&] { counter.fetch_add(1, std::memory_order_relaxed); });
+  pool.WaitForCompletion();
+  EXPECT_EQ(TASK_COUNT + 1, counter.load());
+}
+
+TEST(ThreadPool, ShutdownCancel)
+{
+  Common::ThreadPool pool("ThreadPoolTest", 1);
+
+  Common::Event started;
+  Common::Event release;
+  std::atomic<int> counter = 0;
+
+  // Keep the only worker busy so that the following tasks stay queued
+  pool.Push([&] {
+    started.Set();
+    release.Wait();
+    counter.fetch_add(1);
+  });
+  started.Wait();
+
+  for (int i = 0; i < 10; ++i)
+    pool.Push([&] { counter.fetch_add(100); });
+
+  std::thread shutdown_thread([&] { pool.Shutdown(true); });
+  while (!pool.IsCancelling())
+    std::this_thread::yield();
+  release.Set();
+  shutdown_thread.join();
+
+  // The running task finished, but the queued ones were discarded
+  EXPECT_EQ(1, counter.load());
+  EXPECT_FALSE(pool.IsRunning());
+
+  // Waiting must not block on the discarded tasks
+  pool.WaitForCompletion();
+}
+
+TEST(ThreadPool, ShutdownFinishesQueuedTasks)
+{
+  Common::ThreadPool pool("ThreadPoolTest", 2);
+
+  std::atomic<int> counter = 0;
+  for (int i = 0; i < 100; ++i)
+    pool.Push([&] { counter.fetch_add(1); });
+
+  pool.Shutdown();
+  EXPECT_EQ(100, counter.load());
+}
+
+TEST(ThreadPool, ParallelFor)
+{
+  Common::ThreadPool pool("ThreadPoolTest", 4);
+
+  constexpr u32 COUNT = 10000;
+  std::vector<u32> results(COUNT);
+  pool.ParallelFor(COUNT, [&](u32 i) { results[i] += i + 1; });
+
+  for (u32 i = 0; i < COUNT; ++i)
+    EXPECT_EQ(i + 1, results[i]);
+
+  // Edge cases which don't use the workers
+  pool.ParallelFor(0, [&](u32) { ADD_FAILURE(); });
+  u32 single = 0;
+  pool.ParallelFor(1, [&](u32 i) { single += i + 1; });
+  EXPECT_EQ(1u, single);
+}
+
+TEST(ThreadPool, ParallelForWithoutWorkers)
+{
+  Common::ThreadPool pool;
+
+  std::vector<u32> results(100);
+  pool.ParallelFor(static_cast<u32>(results.size()), [&](u32 i) { results[i] = i; });
+
+  for (u32 i = 0; i < results.size(); ++i)
+    EXPECT_EQ(i, results[i]);
+}
+
+TEST(ThreadPool, ParallelForConcurrentCallers)
+{
+  Common::ThreadPool pool("ThreadPoolTest", 3);
+
+  constexpr int CALLER_COUNT = 4;
+  constexpr u32 COUNT = 1000;
+  constexpr int ITERATIONS = 50;
+
+  std::vector<std::vector<u32>> results(CALLER_COUNT, std::vector<u32>(COUNT));
+  std::vector<std::thread> callers;
+  for (int caller = 0; caller < CALLER_COUNT; ++caller)
+  {
+    callers.emplace_back([&, caller] {
+      for (int iteration = 0; iteration < ITERATIONS; ++iteration)
+        pool.ParallelFor(COUNT, [&](u32 i) { results[caller][i]++; });
+    });
+  }
+  for (std::thread& thread : callers)
+    thread.join();
+
+  // Every index of every call ran exactly once
+  for (int caller = 0; caller < CALLER_COUNT; ++caller)
+  {
+    for (u32 i = 0; i < COUNT; ++i)
+      EXPECT_EQ(static_cast<u32>(ITERATIONS), results[caller][i]);
+  }
+}
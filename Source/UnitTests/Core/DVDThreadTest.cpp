@@ -0,0 +1,123 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "Common/ChunkFile.h"
+#include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/LogManager.h"
+#include "Common/Swap.h"
+#include "Core/ConfigManager.h"
+#include "Core/Core.h"
+#include "Core/CoreTiming.h"
+#include "Core/HW/DVD/DVDInterface.h"
+#include "Core/HW/DVD/DVDThread.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+#include "DiscIO/Volume.h"
+#include "DiscIO/VolumeDisc.h"
+#include "UICommon/UICommon.h"
+
+namespace
+{
+constexpr u32 DISC_SIZE = 0x800000;
+constexpr u32 READ_SIZE = 0x800;
+constexpr u32 NUM_READS = 64;
+
+class ScopeInit final
+{
+public:
+  explicit ScopeInit(Core::System& system) : m_system(system), m_profile_path(File::CreateTempDir())
+  {
+    if (!UserDirectoryExists())
+      return;
+
+    Core::DeclareAsCPUThread();
+    UICommon::SetUserDirectory(m_profile_path);
+    Config::Init();
+    SConfig::Init();
+    // The DVD thread checks whether file accesses are logged
+    Common::Log::LogManager::Init();
+    system.GetPowerPC().Init(PowerPC::CPUCore::Interpreter);
+    system.GetCoreTiming().Init();
+    system.GetDVDThread().Start();
+  }
+  ~ScopeInit()
+  {
+    if (!UserDirectoryExists())
+      return;
+
+    m_system.GetDVDThread().Stop();
+    m_system.GetCoreTiming().Shutdown();
+    m_system.GetPowerPC().Shutdown();
+    Common::Log::LogManager::Shutdown();
+    SConfig::Shutdown();
+    Config::Shutdown();
+    Core::UndeclareAsCPUThread();
+    File::DeleteDirRecursively(m_profile_path);
+  }
+  bool UserDirectoryExists() const { return !m_profile_path.empty(); }
+  const std::string& GetProfilePath() const { return m_profile_path; }
+
+private:
+  Core::System& m_system;
+  std::string m_profile_path;
+};
+
+// Writes a GameCube disc image which only has the magic word, so that it's recognized as a disc.
+bool WriteDisc(const std::string& path)
+{
+  std::vector<u8> data(DISC_SIZE);
+  for (u32 i = 0; i < DISC_SIZE; ++i)
+    data[i] = static_cast<u8>(i ^ (i >> 11));
+
+  const u32 magic = Common::swap32(0xC2339F3D);
+  std::memcpy(data.data() + 0x1C, &magic, sizeof(magic));
+
+  File::IOFile file(path, "wb");
+  return file.WriteBytes(data.data(), data.size());
+}
+}  // namespace
+
+TEST(DVDThread, SavestateWithPendingBatch)
+{
+  auto& system = Core::System::GetInstance();
+
+  ScopeInit guard(system);
+  ASSERT_TRUE(guard.UserDirectoryExists());
+
+  const std::string disc_path = guard.GetProfilePath() + "/disc.iso";
+  ASSERT_TRUE(WriteDisc(disc_path));
+
+  auto& dvd_thread = system.GetDVDThread();
+  dvd_thread.SetDisc(DiscIO::CreateDisc(disc_path));
+  ASSERT_TRUE(dvd_thread.HasDisc());
+
+  // Reads which alternate between two halves of the disc can't be combined, so the DVD thread
+  // splits them into many groups
+  for (u32 i = 0; i < NUM_READS; ++i)
+  {
+    const u64 offset = (i % 2 == 0 ? 0 : DISC_SIZE / 2) + u64(i) * READ_SIZE;
+    dvd_thread.StartRead(offset, READ_SIZE, DiscIO::PARTITION_NONE, DVD::ReplyType::NoReply,
+                         1000000);
+  }
+
+  // Making a savestate waits for the DVD thread, which has to finish every read it has started
+  std::vector<u8> buffer(NUM_READS * READ_SIZE * 2);
+  u8* ptr = buffer.data();
+  PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Write);
+  dvd_thread.DoState(p);
+  ASSERT_TRUE(p.IsWriteMode());
+
+  // The results of all reads are saved, starting with their count
+  u32 num_results;
+  std::memcpy(&num_results, buffer.data(), sizeof(num_results));
+  EXPECT_EQ(NUM_READS, num_results);
+}
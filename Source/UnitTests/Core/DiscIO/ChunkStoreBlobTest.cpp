@@ -0,0 +1,233 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileSearch.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "DiscIO/Blob.h"
+#include "DiscIO/ChunkStoreBlob.h"
+
+namespace
+{
+constexpr u32 CHUNK_SIZE = 0x8000;
+
+class MemoryBlobReader final : public DiscIO::BlobReader
+{
+public:
+  explicit MemoryBlobReader(std::vector<u8> data) : m_data(std::move(data)) {}
+
+  DiscIO::BlobType GetBlobType() const override { return DiscIO::BlobType::PLAIN; }
+  u64 GetRawSize() const override { return m_data.size(); }
+  u64 GetDataSize() const override { return m_data.size(); }
+  DiscIO::DataSizeType GetDataSizeType() const override
+  {
+    return DiscIO::DataSizeType::Accurate;
+  }
+  u64 GetBlockSize() const override { return 0; }
+  bool HasFastRandomAccessInBlock() const override { return true; }
+  std::string GetCompressionMethod() const override { return {}; }
+  std::optional<int> GetCompressionLevel() const override { return std::nullopt; }
+
+  bool Read(u64 offset, u64 size, u8* out_ptr) override
+  {
+    if (offset + size > m_data.size())
+      return false;
+    std::copy_n(m_data.begin() + offset, size, out_ptr);
+    return true;
+  }
+
+private:
+  std::vector<u8> m_data;
+};
+
+// Returns chunks which don't compress, so that both ways of storing chunks are tested.
+std::vector<u8> MakeNoise(u32 size, u32 seed)
+{
+  std::vector<u8> data(size);
+  for (u8& byte : data)
+  {
+    seed = seed * 1103515245 + 12345;
+    byte = static_cast<u8>(seed >> 16);
+  }
+  return data;
+}
+
+std::vector<u8> MakeDisc()
+{
+  std::vector<u8> data;
+  const auto append = [&data](const std::vector<u8>& chunk) {
+    data.insert(data.end(), chunk.begin(), chunk.end());
+  };
+
+  const std::vector<u8> zeroes(CHUNK_SIZE);
+  const std::vector<u8> noise = MakeNoise(CHUNK_SIZE, 1);
+  std::vector<u8> pattern(CHUNK_SIZE);
+  for (u32 i = 0; i < CHUNK_SIZE; i++)
+    pattern[i] = static_cast<u8>(i / 7);
+
+  // Chunks 0, 1 and 4 are the same, and so are chunks 2 and 5. The last chunk is partial.
+  append(zeroes);
+  append(zeroes);
+  append(noise);
+  append(pattern);
+  append(zeroes);
+  append(noise);
+  append(MakeNoise(CHUNK_SIZE / 2 + 3, 2));
+  return data;
+}
+}  // namespace
+
+class ChunkStoreBlobTest : public testing::Test
+{
+protected:
+  ChunkStoreBlobTest()
+      : m_directory(File::CreateTempDir()), m_store_path(m_directory + "/store"),
+        m_manifest_path(m_directory + "/disc.dcs"), m_data(MakeDisc())
+  {
+  }
+
+  ~ChunkStoreBlobTest() override
+  {
+    if (!m_directory.empty())
+      File::DeleteDirRecursively(m_directory);
+  }
+
+  void SetUp() override
+  {
+    ASSERT_FALSE(m_directory.empty());
+
+    MemoryBlobReader input(m_data);
+    ASSERT_TRUE(DiscIO::ConvertToChunkStore(&input, "disc.iso", m_manifest_path, m_store_path,
+                                            CHUNK_SIZE, 5, [](const std::string&, float) {
+                                              return true;
+                                            }));
+  }
+
+  std::unique_ptr<DiscIO::ChunkStoreFileReader> OpenManifest() const
+  {
+    return DiscIO::ChunkStoreFileReader::Create(File::IOFile(m_manifest_path, "rb"),
+                                                m_manifest_path);
+  }
+
+  std::vector<std::string> GetChunkFiles() const
+  {
+    std::vector<std::string> paths = Common::DoFileSearch({m_store_path}, {}, true);
+    std::erase_if(paths, [](const std::string& path) { return File::IsDirectory(path); });
+    return paths;
+  }
+
+  const std::string m_directory;
+  const std::string m_store_path;
+  const std::string m_manifest_path;
+  const std::vector<u8> m_data;
+};
+
+TEST_F(ChunkStoreBlobTest, RoundTrip)
+{
+  // Repeated chunks are only stored once
+  EXPECT_EQ(4u, GetChunkFiles().size());
+
+  std::unique_ptr<DiscIO::BlobReader> reader = DiscIO::CreateBlobReader(m_manifest_path);
+  ASSERT_TRUE(reader);
+  EXPECT_EQ(DiscIO::BlobType::CHUNK_STORE, reader->GetBlobType());
+  ASSERT_EQ(m_data.size(), reader->GetDataSize());
+
+  std::vector<u8> data(m_data.size());
+  ASSERT_TRUE(reader->Read(0, data.size(), data.data()));
+  EXPECT_EQ(m_data, data);
+
+  // Reads which cross chunk boundaries, in an order which makes the cache evict chunks
+  for (const u64 offset : {u64(CHUNK_SIZE * 6 + 1), u64(CHUNK_SIZE - 5), u64(CHUNK_SIZE * 3 + 9),
+                           u64(0), u64(CHUNK_SIZE * 5 - 1)})
+  {
+    const u64 size = std::min<u64>(CHUNK_SIZE + 10, m_data.size() - offset);
+    std::vector<u8> part(size);
+    ASSERT_TRUE(reader->Read(offset, size, part.data()));
+    EXPECT_TRUE(std::equal(part.begin(), part.end(), m_data.begin() + offset));
+  }
+
+  // Reads past the end fail
+  EXPECT_FALSE(reader->Read(m_data.size() - 1, 2, data.data()));
+}
+
+TEST_F(ChunkStoreBlobTest, ReconvertAddsNoChunks)
+{
+  const std::vector<std::string> chunk_files = GetChunkFiles();
+
+  MemoryBlobReader input(m_data);
+  const std::string second_manifest_path = m_directory + "/second.dcs";
+  ASSERT_TRUE(DiscIO::ConvertToChunkStore(&input, "disc.iso", second_manifest_path, m_store_path,
+                                          CHUNK_SIZE, 5, [](const std::string&, float) {
+                                            return true;
+                                          }));
+  EXPECT_EQ(chunk_files, GetChunkFiles());
+}
+
+TEST_F(ChunkStoreBlobTest, CorruptedChunk)
+{
+  // Replace every chunk with different data of the same size
+  for (const std::string& path : GetChunkFiles())
+  {
+    const u64 size = File::GetSize(path);
+    File::IOFile file(path, "wb");
+    const std::vector<u8> data = MakeNoise(static_cast<u32>(size), 3);
+    ASSERT_TRUE(file.WriteBytes(data.data(), data.size()));
+  }
+
+  std::unique_ptr<DiscIO::ChunkStoreFileReader> reader = OpenManifest();
+  ASSERT_TRUE(reader);
+  for (u32 i = 0; i < 7; i++)
+  {
+    u8 byte;
+    EXPECT_FALSE(reader->Read(u64(i) * CHUNK_SIZE, 1, &byte));
+  }
+}
+
+TEST_F(ChunkStoreBlobTest, InvalidManifest)
+{
+  DiscIO::ChunkStoreHeader header;
+  {
+    File::IOFile file(m_manifest_path, "rb");
+    ASSERT_TRUE(file.ReadArray(&header, 1));
+  }
+
+  // Returns whether the manifest can be opened with the given header
+  const auto test_header = [&](const DiscIO::ChunkStoreHeader& modified_header) {
+    {
+      File::IOFile file(m_manifest_path, "r+b");
+      EXPECT_TRUE(file.WriteArray(&modified_header, 1));
+    }
+    return OpenManifest() != nullptr;
+  };
+
+  DiscIO::ChunkStoreHeader modified_header = header;
+  modified_header.chunk_size = 0x80000000;
+  modified_header.num_chunks = 1;
+  EXPECT_FALSE(test_header(modified_header));
+
+  modified_header = header;
+  modified_header.store_path_size = 0xFFFFFFFF;
+  EXPECT_FALSE(test_header(modified_header));
+
+  modified_header = header;
+  modified_header.data_size = u64(0xFFFFFFFF) * CHUNK_SIZE;
+  modified_header.num_chunks = 0xFFFFFFFF;
+  EXPECT_FALSE(test_header(modified_header));
+
+  modified_header = header;
+  modified_header.data_size = ~u64(0);
+  modified_header.num_chunks = 0;
+  EXPECT_FALSE(test_header(modified_header));
+
+  EXPECT_TRUE(test_header(header));
+}
@@ -0,0 +1,196 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Core/FifoPlayer/FifoDataFile.h"
+
+class FifoDataFileTest : public testing::Test
+{
+protected:
+  FifoDataFileTest() : m_temp_dir{File::CreateTempDir()} {}
+
+  ~FifoDataFileTest() override
+  {
+    if (!m_temp_dir.empty())
+      File::DeleteDirRecursively(m_temp_dir);
+  }
+
+  void SetUp() override { ASSERT_FALSE(m_temp_dir.empty()); }
+
+  std::vector<u8> RandomData(size_t size)
+  {
+    std::vector<u8> data(size);
+    for (u8& byte : data)
+      byte = static_cast<u8>(m_random());
+    return data;
+  }
+
+  // Creates a file with NUM_FRAMES frames, each with a few memory updates. The first update of
+  // every frame has the same contents if shared_update is set, and different contents otherwise.
+  std::unique_ptr<FifoDataFile> CreateFile(bool shared_update)
+  {
+    auto file = std::make_unique<FifoDataFile>();
+    file->SetIsWii(true);
+    file->GetBPMem()[0x10] = 0x12345678;
+    file->GetTexMem()[0x100] = 0x9A;
+
+    const std::vector<u8> shared_data = RandomData(UPDATE_SIZE);
+    for (u32 i = 0; i < NUM_FRAMES; ++i)
+    {
+      FifoFrameInfo frame;
+      frame.fifoData = RandomData(0x100 + i);
+      frame.fifoStart = 0x1000 * i;
+      frame.fifoEnd = 0x1000 * i + 0x100 + i;
+
+      MemoryUpdate shared;
+      shared.fifoPosition = 0x10;
+      shared.address = 0x80000000;
+      shared.data = shared_update ? shared_data : RandomData(UPDATE_SIZE);
+      shared.type = MemoryUpdate::Type::TextureMap;
+      frame.memoryUpdates.push_back(std::move(shared));
+
+      // Same size as the first update, but different contents
+      MemoryUpdate distinct;
+      distinct.fifoPosition = 0x20;
+      distinct.address = 0x80100000 + i;
+      distinct.data = RandomData(UPDATE_SIZE);
+      distinct.type = MemoryUpdate::Type::VertexStream;
+      frame.memoryUpdates.push_back(std::move(distinct));
+
+      // Updates without data are valid too
+      MemoryUpdate empty;
+      empty.fifoPosition = 0x30;
+      empty.address = 0x80200000;
+      empty.type = MemoryUpdate::Type::XFData;
+      frame.memoryUpdates.push_back(std::move(empty));
+
+      file->AddFrame(frame);
+    }
+
+    return file;
+  }
+
+  static void ExpectEqualFiles(FifoDataFile& expected, FifoDataFile& actual)
+  {
+    EXPECT_EQ(expected.GetIsWii(), actual.GetIsWii());
+    EXPECT_EQ(expected.GetBPMem()[0x10], actual.GetBPMem()[0x10]);
+    EXPECT_EQ(expected.GetTexMem()[0x100], actual.GetTexMem()[0x100]);
+
+    ASSERT_EQ(expected.GetFrameCount(), actual.GetFrameCount());
+    for (u32 i = 0; i < expected.GetFrameCount(); ++i)
+    {
+      const auto expected_frame = expected.GetFrame(i);
+      const auto actual_frame = actual.GetFrame(i);
+      EXPECT_EQ(expected_frame->fifoData, actual_frame->fifoData);
+      EXPECT_EQ(expected_frame->fifoStart, actual_frame->fifoStart);
+      EXPECT_EQ(expected_frame->fifoEnd, actual_frame->fifoEnd);
+
+      const std::vector<MemoryUpdate>* expected_updates = &expected_frame->memoryUpdates;
+      const std::vector<MemoryUpdate>* actual_updates = &actual_frame->memoryUpdates;
+      ASSERT_EQ(expected_updates->size(), actual_updates->size());
+      for (size_t j = 0; j < expected_updates->size(); ++j)
+      {
+        const MemoryUpdate& expected_update = (*expected_updates)[j];
+        const MemoryUpdate& actual_update = (*actual_updates)[j];
+        EXPECT_EQ(expected_update.fifoPosition, actual_update.fifoPosition);
+        EXPECT_EQ(expected_update.address, actual_update.address);
+        EXPECT_EQ(expected_update.type, actual_update.type);
+        EXPECT_EQ(expected_update.data, actual_update.data);
+      }
+    }
+  }
+
+  static constexpr u32 NUM_FRAMES = 12;
+  static constexpr size_t UPDATE_SIZE = 0x4000;
+
+  std::string m_temp_dir;
+  std::mt19937 m_random;
+};
+
+TEST_F(FifoDataFileTest, SaveAndLoad)
+{
+  const auto original = CreateFile(true);
+  const std::string path = m_temp_dir + "/test.dff";
+  ASSERT_TRUE(original->Save(path));
+
+  const auto loaded = FifoDataFile::Load(path, false);
+  ASSERT_NE(nullptr, loaded);
+  ExpectEqualFiles(*original, *loaded);
+
+  // Frames can be read in any order, including ones which are being prefetched
+  loaded->PrefetchFrame(NUM_FRAMES - 1);
+  for (u32 i = NUM_FRAMES; i-- > 0;)
+  {
+    loaded->PrefetchFrame(i > 0 ? i - 1 : 0);
+    EXPECT_EQ(original->GetFrame(i)->fifoData, loaded->GetFrame(i)->fifoData);
+  }
+
+  // Saving a loaded file streams the frames back in, and produces the same contents
+  const std::string resaved_path = m_temp_dir + "/resaved.dff";
+  ASSERT_TRUE(loaded->Save(resaved_path));
+  const auto resaved = FifoDataFile::Load(resaved_path, false);
+  ASSERT_NE(nullptr, resaved);
+  ExpectEqualFiles(*original, *resaved);
+  EXPECT_EQ(File::GetSize(path), File::GetSize(resaved_path));
+}
+
+TEST_F(FifoDataFileTest, IdenticalUpdatesAreStoredOnce)
+{
+  const std::string shared_path = m_temp_dir + "/shared.dff";
+  const std::string distinct_path = m_temp_dir + "/distinct.dff";
+  const auto shared = CreateFile(true);
+  const auto distinct = CreateFile(false);
+  ASSERT_TRUE(shared->Save(shared_path));
+  ASSERT_TRUE(distinct->Save(distinct_path));
+
+  // Random data doesn't compress, so every stored copy takes up about UPDATE_SIZE bytes
+  const u64 shared_size = File::GetSize(shared_path);
+  const u64 distinct_size = File::GetSize(distinct_path);
+  EXPECT_GT(distinct_size, shared_size + (NUM_FRAMES - 1) * UPDATE_SIZE * 9 / 10);
+  EXPECT_LT(distinct_size, shared_size + (NUM_FRAMES - 1) * UPDATE_SIZE * 11 / 10);
+
+  // Sharing the data doesn't mix up the updates which only have the same size
+  const auto shared_loaded = FifoDataFile::Load(shared_path, false);
+  ASSERT_NE(nullptr, shared_loaded);
+  ExpectEqualFiles(*shared, *shared_loaded);
+
+  const auto distinct_loaded = FifoDataFile::Load(distinct_path, false);
+  ASSERT_NE(nullptr, distinct_loaded);
+  ExpectEqualFiles(*distinct, *distinct_loaded);
+}
+
+TEST_F(FifoDataFileTest, FramesAreLoadedWhenNeeded)
+{
+  const auto original = CreateFile(false);
+  const std::string path = m_temp_dir + "/test.dff";
+  ASSERT_TRUE(original->Save(path));
+
+  // Cut off the end of the last frame. Opening the file only reads the list of frames, so it
+  // still succeeds, and only the last frame can't be read.
+  {
+    File::IOFile file(path, "r+b");
+    ASSERT_TRUE(file.Resize(file.GetSize() - 0x10));
+  }
+
+  const auto loaded = FifoDataFile::Load(path, false);
+  ASSERT_NE(nullptr, loaded);
+  ASSERT_EQ(NUM_FRAMES, loaded->GetFrameCount());
+  for (u32 i = 0; i < NUM_FRAMES - 1; ++i)
+    EXPECT_EQ(original->GetFrame(i)->fifoData, loaded->GetFrame(i)->fifoData);
+
+  const auto last_frame = loaded->GetFrame(NUM_FRAMES - 1);
+  EXPECT_TRUE(last_frame->fifoData.empty());
+  EXPECT_TRUE(last_frame->memoryUpdates.empty());
+
+  // A file with a frame which can't be read can't be saved again
+  EXPECT_FALSE(loaded->Save(m_temp_dir + "/resaved.dff"));
+}
@@ -0,0 +1,154 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>  // NOLINT
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/CPMemory.h"
+#include "VideoCommon/DisplayListCache.h"
+#include "VideoCommon/OpcodeDecoding.h"
+
+namespace
+{
+// Logs the commands it is called with, including the vertex data of primitives.
+class LoggingCallback final : public OpcodeDecoder::Callback
+{
+public:
+  OPCODE_CALLBACK(void OnXF(u16 address, u8 count, const u8* data))
+  {
+    log.push_back(fmt::format("XF {:04x} {}", address, count));
+  }
+  OPCODE_CALLBACK(void OnCP(u8 command, u32 value))
+  {
+    log.push_back(fmt::format("CP {:02x} {:08x}", command, value));
+  }
+  OPCODE_CALLBACK(void OnBP(u8 command, u32 value))
+  {
+    log.push_back(fmt::format("BP {:02x} {:06x}", command, value));
+  }
+  OPCODE_CALLBACK(void OnIndexedLoad(CPArray array, u32 index, u16 address, u8 size))
+  {
+    log.push_back(
+        fmt::format("Indexed {} {} {} {}", static_cast<int>(array), index, address, size));
+  }
+  OPCODE_CALLBACK(void OnPrimitiveCommand(OpcodeDecoder::Primitive primitive, u8 vat,
+                                          u32 vertex_size, u16 num_vertices,
+                                          const u8* vertex_data))
+  {
+    std::string entry = fmt::format("Primitive {} {} {} {}", static_cast<int>(primitive), vat,
+                                    vertex_size, num_vertices);
+    for (u32 i = 0; i < vertex_size * num_vertices; i++)
+      entry += fmt::format(" {:02x}", vertex_data[i]);
+    log.push_back(std::move(entry));
+  }
+  OPCODE_CALLBACK(void OnDisplayList(u32 address, u32 size))
+  {
+    log.push_back(fmt::format("DisplayList {:08x} {}", address, size));
+  }
+  OPCODE_CALLBACK(void OnNop(u32 count)) { log.push_back(fmt::format("Nop {}", count)); }
+  OPCODE_CALLBACK(void OnUnknown(u8 opcode, const u8* data))
+  {
+    log.push_back(fmt::format("Unknown {:02x}", opcode));
+  }
+  OPCODE_CALLBACK(void OnCommand(const u8* data, u32 size)) { bytes_processed += size; }
+  OPCODE_CALLBACK(CPState& GetCPState()) { return cp_state; }
+  OPCODE_CALLBACK(u32 GetVertexSize(u8 vat)) { return vertex_size; }
+
+  std::vector<std::string> log;
+  u32 bytes_processed = 0;
+  u32 vertex_size = 2;
+  CPState cp_state;
+};
+
+constexpr u32 LIST_ADDRESS = 0x00100000;
+
+// A BP load, a CP load, two NOPs and a triangle of 2 byte vertices.
+std::vector<u8> MakeDisplayList()
+{
+  return {0x61, 0x20, 0x12, 0x34, 0x56,        // BP
+          0x08, 0x50, 0x00, 0x00, 0x06, 0x00,  // CP
+          0x00, 0x00,                          // NOPs
+          0x90, 0x00, 0x03,                    // Triangles with VAT 0
+          0x01, 0x02, 0x03, 0x04, 0x05, 0x06};
+}
+
+std::vector<std::string> Decode(const std::vector<u8>& list, u32 vertex_size)
+{
+  LoggingCallback callback;
+  callback.vertex_size = vertex_size;
+  const u32 size = static_cast<u32>(list.size());
+  EXPECT_EQ(size, OpcodeDecoder::Run(list.data(), size, callback));
+  return callback.log;
+}
+
+std::vector<std::string> RunCached(DisplayListCache& cache, const std::vector<u8>& list,
+                                   u64 write_generation, u32 vertex_size = 2)
+{
+  LoggingCallback callback;
+  callback.vertex_size = vertex_size;
+  const u32 size = static_cast<u32>(list.size());
+  EXPECT_EQ(size, cache.Run(LIST_ADDRESS, size, list.data(), write_generation, callback));
+  EXPECT_EQ(size, callback.bytes_processed);
+  return callback.log;
+}
+}  // namespace
+
+TEST(DisplayListCache, ReplayMatchesDecoding)
+{
+  DisplayListCache cache;
+  const std::vector<u8> list = MakeDisplayList();
+  const std::vector<std::string> expected = Decode(list, 2);
+
+  EXPECT_EQ(expected, RunCached(cache, list, 1));
+  EXPECT_EQ(expected, RunCached(cache, list, 1));
+}
+
+TEST(DisplayListCache, HitAndInvalidation)
+{
+  DisplayListCache cache;
+  std::vector<u8> list = MakeDisplayList();
+  const std::vector<std::string> original = Decode(list, 2);
+  RunCached(cache, list, 1);
+
+  // Modify the value of the BP load. With an unchanged write generation, the decoded commands
+  // are replayed, which still contain the old value. The vertex data is read from the list.
+  list[4] = 0x78;
+  list[16] = 0xff;
+  std::vector<std::string> replayed = RunCached(cache, list, 1);
+  ASSERT_EQ(original.size(), replayed.size());
+  EXPECT_EQ(original[0], replayed[0]);
+  EXPECT_EQ(Decode(list, 2).back(), replayed.back());
+
+  // A new write generation makes the list get decoded again.
+  const std::vector<std::string> modified = Decode(list, 2);
+  EXPECT_NE(original[0], modified[0]);
+  EXPECT_EQ(modified, RunCached(cache, list, 2));
+  EXPECT_EQ(modified, RunCached(cache, list, 2));
+
+  // So does clearing the cache.
+  list[4] = 0x9a;
+  cache.Clear();
+  EXPECT_EQ(Decode(list, 2), RunCached(cache, list, 2));
+}
+
+TEST(DisplayListCache, VertexSizeChange)
+{
+  DisplayListCache cache;
+  const std::vector<u8> list = MakeDisplayList();
+  RunCached(cache, list, 1);
+
+  // With a vertex size of 1, the triangle covers 3 bytes less, and the rest of the list is
+  // decoded as unknown commands. The commands in front of the primitive are replayed.
+  const u32 size = static_cast<u32>(list.size());
+  LoggingCallback callback;
+  callback.vertex_size = 1;
+  EXPECT_EQ(size, cache.Run(LIST_ADDRESS, size, list.data(), 1, callback));
+  EXPECT_EQ(Decode(list, 1), callback.log);
+
+  // The entry is updated for the new vertex size.
+  EXPECT_EQ(Decode(list, 1), RunCached(cache, list, 1, 1));
+}
@@ -1,20 +1,24 @@
 // Copyright 2014 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <tuple>
 #include <type_traits>
 #include <unordered_set>
+#include <vector>
 
 #include <gtest/gtest.h>  // NOLINT
 
 #include "Common/BitUtils.h"
 #include "Common/Common.h"
 #include "Common/MathUtil.h"
+#include "Common/ThreadPool.h"
 #include "VideoCommon/CPMemory.h"
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/VertexDecodeCache.h"
 #include "VideoCommon/VertexLoaderBase.h"
 #include "VideoCommon/VertexLoaderManager.h"
 
@@ -759,6 +763,173 @@ TEST_P(VertexLoaderNormalTest, NormalAll)
   }
 }
 
+TEST_F(VertexLoaderTest, IndexedArrayOffsets)
+{
+  m_vtx_desc.low.PosMatIdx = 1;
+  m_vtx_desc.low.Position = VertexComponentFormat::Index16;
+  m_vtx_desc.low.Color0 = VertexComponentFormat::Direct;
+  m_vtx_desc.high.Tex0Coord = VertexComponentFormat::Index8;
+  m_vtx_attr.g0.PosElements = CoordComponentCount::XYZ;
+  m_vtx_attr.g0.PosFormat = ComponentFormat::Float;
+  m_vtx_attr.g0.Color0Elements = ColorComponentCount::RGBA;
+  m_vtx_attr.g0.Color0Comp = ColorFormat::RGBA8888;
+  m_vtx_attr.g0.Tex0CoordElements = TexComponentCount::ST;
+  m_vtx_attr.g0.Tex0CoordFormat = ComponentFormat::Short;
+
+  const auto arrays = VertexLoaderBase::GetIndexedArrays(m_vtx_desc, m_vtx_attr);
+  ASSERT_EQ(2u, arrays.size());
+  EXPECT_EQ(CPArray::Position, arrays[0].array);
+  EXPECT_EQ(1, arrays[0].offset);
+  EXPECT_EQ(2, arrays[0].index_size);
+  EXPECT_EQ(12, arrays[0].element_size);
+  EXPECT_EQ(CPArray::TexCoord0, arrays[1].array);
+  EXPECT_EQ(7, arrays[1].offset);
+  EXPECT_EQ(1, arrays[1].index_size);
+  EXPECT_EQ(4, arrays[1].element_size);
+}
+
+TEST_F(VertexLoaderTest, IndexedArrayOffsetsNormalIndex3)
+{
+  m_vtx_desc.low.Position = VertexComponentFormat::Direct;
+  m_vtx_desc.low.Normal = VertexComponentFormat::Index8;
+  m_vtx_attr.g0.PosElements = CoordComponentCount::XYZ;
+  m_vtx_attr.g0.PosFormat = ComponentFormat::Float;
+  m_vtx_attr.g0.NormalElements = NormalComponentCount::NTB;
+  m_vtx_attr.g0.NormalFormat = ComponentFormat::Float;
+  m_vtx_attr.g0.NormalIndex3 = 1;
+
+  // Each index only reads its own vector of the element
+  const auto arrays = VertexLoaderBase::GetIndexedArrays(m_vtx_desc, m_vtx_attr);
+  ASSERT_EQ(3u, arrays.size());
+  for (int i = 0; i < 3; i++)
+  {
+    EXPECT_EQ(CPArray::Normal, arrays[i].array);
+    EXPECT_EQ(12 + i, arrays[i].offset);
+    EXPECT_EQ(1, arrays[i].index_size);
+    EXPECT_EQ(12 * i, arrays[i].element_offset);
+    EXPECT_EQ(12, arrays[i].element_size);
+  }
+}
+
+TEST_F(VertexLoaderTest, DecodeCacheHitAndInvalidation)
+{
+  m_vtx_desc.low.Position = VertexComponentFormat::Index8;
+  m_vtx_attr.g0.PosElements = CoordComponentCount::XYZ;
+  m_vtx_attr.g0.PosFormat = ComponentFormat::Float;
+  CreateAndCheckSizes(1, 3 * sizeof(float));
+
+  constexpr int NUM_VERTICES = 100;
+  constexpr int NUM_POSITIONS = 16;
+  for (int i = 0; i < NUM_VERTICES; i++)
+    Input<u8>(i % NUM_POSITIONS);
+
+  // Leave an unused element after the ones the draw reads
+  u8* const array = m_src.GetPointer();
+  VertexLoaderManager::cached_arraybases[CPArray::Position] = array;
+  g_main_cp_state.array_strides[CPArray::Position] = 3 * sizeof(float);
+  for (int i = 0; i < (NUM_POSITIONS + 1) * 3; i++)
+    Input(i * 0.25f);
+
+  VertexDecodeCache cache;
+  const auto key = cache.GetKey(m_loader.get(), input_memory, NUM_VERTICES);
+  ASSERT_TRUE(key.has_value());
+
+  const u32 stride = m_loader->m_native_vtx_decl.stride;
+  std::vector<u8> cached_output(NUM_VERTICES * stride + 16);
+  EXPECT_EQ(-1, cache.Load(*key, m_loader.get(), input_memory, cached_output.data(),
+                           NUM_VERTICES));
+
+  // The first draw is only noted, the second one is kept
+  RunVertices(NUM_VERTICES);
+  cache.Store(*key, m_loader.get(), output_memory, NUM_VERTICES, NUM_VERTICES);
+  EXPECT_EQ(-1, cache.Load(*key, m_loader.get(), input_memory, cached_output.data(),
+                           NUM_VERTICES));
+  cache.Store(*key, m_loader.get(), output_memory, NUM_VERTICES, NUM_VERTICES);
+  ASSERT_EQ(NUM_VERTICES, cache.Load(*key, m_loader.get(), input_memory, cached_output.data(),
+                                     NUM_VERTICES));
+  EXPECT_EQ(0, std::memcmp(output_memory, cached_output.data(), NUM_VERTICES * stride));
+
+  // Memory which the draw doesn't read doesn't affect the key
+  Common::BitCastPtr<float>(array + NUM_POSITIONS * 3 * sizeof(float)) = 100.0f;
+  const auto unrelated_key = cache.GetKey(m_loader.get(), input_memory, NUM_VERTICES);
+  ASSERT_TRUE(unrelated_key.has_value());
+  EXPECT_EQ(key->hash, unrelated_key->hash);
+  EXPECT_EQ(key->check, unrelated_key->check);
+
+  // Writing to an element the draw reads misses the cache
+  Common::BitCastPtr<float>(array + 5 * 3 * sizeof(float)) = 100.0f;
+  const auto modified_key = cache.GetKey(m_loader.get(), input_memory, NUM_VERTICES);
+  ASSERT_TRUE(modified_key.has_value());
+  EXPECT_NE(key->hash, modified_key->hash);
+  EXPECT_NE(key->check, modified_key->check);
+  EXPECT_EQ(-1, cache.Load(*modified_key, m_loader.get(), input_memory, cached_output.data(),
+                           NUM_VERTICES));
+
+  // A colliding hash with different data is not mistaken for the cached draw
+  VertexDecodeCache::Key colliding_key = *modified_key;
+  colliding_key.hash = key->hash;
+  EXPECT_EQ(-1, cache.Load(colliding_key, m_loader.get(), input_memory, cached_output.data(),
+                           NUM_VERTICES));
+}
+
+TEST_F(VertexLoaderTest, ParallelRangesMatchSerial)
+{
+  m_vtx_desc.low.PosMatIdx = 1;
+  m_vtx_desc.low.Position = VertexComponentFormat::Index16;
+  m_vtx_desc.low.Color0 = VertexComponentFormat::Direct;
+  m_vtx_desc.high.Tex0Coord = VertexComponentFormat::Direct;
+  m_vtx_attr.g0.PosElements = CoordComponentCount::XYZ;
+  m_vtx_attr.g0.PosFormat = ComponentFormat::Float;
+  m_vtx_attr.g0.Color0Elements = ColorComponentCount::RGBA;
+  m_vtx_attr.g0.Color0Comp = ColorFormat::RGBA8888;
+  m_vtx_attr.g0.Tex0CoordElements = TexComponentCount::ST;
+  m_vtx_attr.g0.Tex0CoordFormat = ComponentFormat::Short;
+  m_vtx_attr.g0.Tex0Frac = 4;
+  m_loader = VertexLoaderBase::CreateVertexLoader(m_vtx_desc, m_vtx_attr);
+  if (!m_loader->SupportsConcurrentLoading())
+    GTEST_SKIP() << "Vertex loader does not support concurrent loading";
+
+  constexpr int NUM_VERTICES = 1000;
+  constexpr int NUM_POSITIONS = 64;
+  int expected_count = 0;
+  for (int i = 0; i < NUM_VERTICES; i++)
+  {
+    // Vertices with a position index of 0xFFFF are skipped, which shifts the following ranges.
+    const bool skipped = i % 97 == 5;
+    Input<u8>(i % 10);
+    Input<u16>(skipped ? 0xFFFF : i % NUM_POSITIONS);
+    Input<u32>(0x01020304 * i);
+    Input<s16>(i);
+    Input<s16>(-i);
+    expected_count += skipped ? 0 : 1;
+  }
+  VertexLoaderManager::cached_arraybases[CPArray::Position] = m_src.GetPointer();
+  g_main_cp_state.array_strides[CPArray::Position] = 3 * sizeof(float);
+  for (int i = 0; i < NUM_POSITIONS * 3; i++)
+    Input(i * 0.5f);
+
+  RunVertices(NUM_VERTICES, expected_count);
+  const auto serial_position_cache = VertexLoaderManager::position_cache;
+  const auto serial_posmtx_cache = VertexLoaderManager::position_matrix_index_cache;
+
+  const u32 stride = m_loader->m_native_vtx_decl.stride;
+  std::vector<u8> parallel_output(NUM_VERTICES * stride + 16);
+  Common::ThreadPool pool("Vertex Loader Test", 3);
+  for (u32 num_ranges : {2, 4, 7})
+  {
+    std::fill(parallel_output.begin(), parallel_output.end(), 0xFF);
+    VertexLoaderManager::position_cache = {};
+    VertexLoaderManager::position_matrix_index_cache = {};
+
+    const int count = VertexLoaderManager::RunVerticesInRanges(
+        pool, m_loader.get(), input_memory, parallel_output.data(), NUM_VERTICES, num_ranges);
+    ASSERT_EQ(expected_count, count);
+    EXPECT_EQ(0, std::memcmp(output_memory, parallel_output.data(), count * stride));
+    EXPECT_EQ(serial_position_cache, VertexLoaderManager::position_cache);
+    EXPECT_EQ(serial_posmtx_cache, VertexLoaderManager::position_matrix_index_cache);
+  }
+}
+
 // For gtest, which doesn't know about our fmt::formatters by default
 static void PrintTo(const VertexComponentFormat& t, std::ostream* os)
 {